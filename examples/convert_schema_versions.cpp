@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+// Example OTIO C++ code that converts every .otio file in a directory to the
+// schema versions of an older (or the current) release, writing the results
+// to another directory.  For example, to write files that OTIO 0.14.0 can
+// read:
+//
+//     convert_schema_versions archive converted 0.14.0
+//
+// Schema versions can also be given one at a time, as in Clip=1, on their own
+// or after a release.  Without either, files are converted to the current
+// versions.  The files are converted on one thread per CPU, and each is
+// streamed, so that only the objects whose versions change are ever read into
+// memory.
+
+#include "util.h"
+
+#include <opentimelineio/serialization.h>
+#include <opentimelineio/typeRegistry.h>
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cout << "Usage: convert_schema_versions (input directory) (output directory) [release] [schema=version ...]" << std::endl;
+        std::cout << "Releases:";
+        for (auto const& release : otio::CORE_VERSION_MAP)
+        {
+            std::cout << " " << release.first;
+        }
+        std::cout << std::endl;
+        return 1;
+    }
+    std::string const input_dir = argv[1];
+    std::string const output_dir = argv[2];
+
+    otio::schema_version_map targets;
+    for (int i = 3; i < argc; ++i)
+    {
+        std::string const arg = argv[i];
+        auto const separator = arg.find('=');
+        if (separator != std::string::npos)
+        {
+            targets[arg.substr(0, separator)] = std::stoll(arg.substr(separator + 1));
+            continue;
+        }
+        auto const release = otio::CORE_VERSION_MAP.find(arg);
+        if (release == otio::CORE_VERSION_MAP.end())
+        {
+            std::cerr << "ERROR: unknown release " << arg << std::endl;
+            return 1;
+        }
+        for (auto const& schema : release->second)
+        {
+            targets.emplace(schema);
+        }
+    }
+
+    auto const input_files = examples::glob(input_dir, "*.otio");
+
+    std::atomic<size_t> next(0);
+    std::atomic<size_t> failures(0);
+    std::mutex output_mutex;
+    auto const convert = [&]()
+    {
+        for (size_t i = next++; i < input_files.size(); i = next++)
+        {
+            std::string const& input_file = input_files[i];
+            std::string const output_file = output_dir + '/' +
+                input_file.substr(input_file.find_last_of('/') + 1);
+
+            otio::ErrorStatus error_status;
+            if (!otio::convert_json_file(input_file, output_file, &targets, &error_status))
+            {
+                ++failures;
+                std::lock_guard<std::mutex> lock(output_mutex);
+                std::cout << input_file << ": ";
+                examples::print_error(error_status);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < std::thread::hardware_concurrency(); ++i)
+    {
+        threads.emplace_back(convert);
+    }
+    convert();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::cout << "Converted " << input_files.size() - failures << " of " <<
+        input_files.size() << " files." << std::endl;
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentime/rationalTime.h"
+#include "opentime/version.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+namespace opentime { namespace OPENTIME_VERSION {
+
+/// @brief This class represents a whole number of frames at a rate that is
+/// an exact fraction, such as 24000/1001.
+///
+/// Unlike RationalTime, arithmetic and comparisons are exact: times at
+/// different rates are brought to a common rate whose frames evenly divide
+/// the frames of both, so summing a long run of durations at NTSC rates
+/// accumulates no error.
+///
+/// Values and rate terms are 64-bit integers; the common rate of two times
+/// is the least common multiple of their rates, so mixing rates with large,
+/// coprime numerators shrinks the range of values that can be represented.
+/// For the SMPTE rates this is not a practical concern.  An addition or
+/// subtraction that overflows gives an invalid time, as does a rate that is
+/// not positive; see is_invalid_time().
+class ExactTime
+{
+public:
+    /// @brief Construct a time of value frames at a rate of
+    /// rate_numerator / rate_denominator frames per second.
+    ///
+    /// The rate is reduced to lowest terms; unless both terms are positive,
+    /// the time is invalid.
+    explicit constexpr ExactTime(
+        int64_t value            = 0,
+        int64_t rate_numerator   = 1,
+        int64_t rate_denominator = 1) noexcept
+        : _value{ value }
+        , _rate_num{ rate_numerator }
+        , _rate_den{ rate_denominator }
+    {
+        if (_rate_num <= 0 || _rate_den <= 0)
+        {
+            _rate_num = 0;
+            _rate_den = 1;
+            return;
+        }
+
+        int64_t const divisor = std::gcd(_rate_num, _rate_den);
+        if (divisor > 1)
+        {
+            _rate_num /= divisor;
+            _rate_den /= divisor;
+        }
+    }
+
+    /// @brief Returns true if the time is invalid: its rate was not
+    /// positive, or it is the result of an operation that overflowed.
+    constexpr bool is_invalid_time() const noexcept { return _rate_num <= 0; }
+
+    /// @brief Returns the number of frames.
+    constexpr int64_t value() const noexcept { return _value; }
+
+    /// @brief Returns the numerator of the rate, in lowest terms.
+    constexpr int64_t rate_numerator() const noexcept { return _rate_num; }
+
+    /// @brief Returns the denominator of the rate, in lowest terms.
+    constexpr int64_t rate_denominator() const noexcept { return _rate_den; }
+
+    /// @brief Returns the rate as a floating point number.
+    constexpr double rate() const noexcept
+    {
+        return double(_rate_num) / double(_rate_den);
+    }
+
+    /// @brief Returns whether this time has the same rate as another time.
+    constexpr bool same_rate(ExactTime other) const noexcept
+    {
+        return _rate_num == other._rate_num && _rate_den == other._rate_den;
+    }
+
+    /// @brief Returns the time converted to the common rate of this time
+    /// and another, at which both have a whole number of frames, or an
+    /// invalid time if the rate or the value overflows.
+    constexpr ExactTime rescaled_to_common_rate(ExactTime other) const noexcept
+    {
+        if (same_rate(other) || is_invalid_time())
+        {
+            return *this;
+        }
+        if (other.is_invalid_time())
+        {
+            return other;
+        }
+
+        // num is the least common multiple of the numerators
+        int64_t const den   = std::gcd(_rate_den, other._rate_den);
+        int64_t       num   = 0;
+        int64_t       scale = 0;
+        int64_t       value = 0;
+        if (!_multiply(
+                _rate_num / std::gcd(_rate_num, other._rate_num),
+                other._rate_num,
+                &num)
+            || !_multiply(num / _rate_num, _rate_den / den, &scale)
+            || !_multiply(_value, scale, &value))
+        {
+            return _invalid();
+        }
+        return ExactTime{ value, num, den };
+    }
+
+    /// @brief Return this time plus a number of frames at its own rate, or
+    /// an invalid time if the value overflows.
+    constexpr ExactTime plus_frames(int64_t frames) const noexcept
+    {
+        int64_t value = 0;
+        return _add(_value, frames, &value) ? ExactTime{ value, *this }
+                                            : _invalid();
+    }
+
+    /// @brief Convert a RationalTime losslessly.
+    ///
+    /// This succeeds when the value is a whole number of frames and the
+    /// rate is exactly an integer, an NTSC rate such as 30000/1001, or a
+    /// decimal with up to three places such as 29.97.
+    static std::optional<ExactTime>
+    from_rational_time(RationalTime time) noexcept
+    {
+        double const value = time.value();
+        double const rate  = time.rate();
+        if (!(std::fabs(value) < 9007199254740992.0)
+            || value != std::trunc(value) || !(rate > 0)
+            || !(rate < 2147483648.0))
+        {
+            return std::nullopt;
+        }
+
+        for (int64_t den: { 1, 1001, 1000 })
+        {
+            double const num = std::round(rate * double(den));
+            if (num / double(den) == rate)
+            {
+                return ExactTime{ int64_t(value), int64_t(num), den };
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Convert to a RationalTime at this time's rate.
+    constexpr RationalTime to_rational_time() const noexcept
+    {
+        return RationalTime{ double(_value), rate() };
+    }
+
+    /// @brief Convert to a RationalTime at the given rate.
+    ///
+    /// The value is computed with a single rounding, however many exact
+    /// operations produced this time.
+    constexpr RationalTime to_rational_time(double new_rate) const noexcept
+    {
+        return new_rate == rate()
+                   ? RationalTime{ double(_value), new_rate }
+                   : RationalTime{ double(_value) * double(_rate_den)
+                                       * new_rate / double(_rate_num),
+                                   new_rate };
+    }
+
+    /// @brief Returns the value in seconds.
+    constexpr double to_seconds() const noexcept
+    {
+        return double(_value) * double(_rate_den) / double(_rate_num);
+    }
+
+    /// @brief Return the addition of two times, at their common rate, or
+    /// an invalid time if either is invalid or the result overflows.
+    friend constexpr ExactTime operator+(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        ExactTime const l = lhs.rescaled_to_common_rate(rhs);
+        ExactTime const r = rhs.rescaled_to_common_rate(lhs);
+        return l.is_invalid_time() || r.is_invalid_time()
+                   ? _invalid()
+                   : l.plus_frames(r._value);
+    }
+
+    /// @brief Return the subtraction of two times, at their common rate, or
+    /// an invalid time if either is invalid or the result overflows.
+    friend constexpr ExactTime operator-(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        return lhs + -rhs;
+    }
+
+    /// @brief Return the negative of this time, or an invalid time if the
+    /// value cannot be negated.
+    friend constexpr ExactTime operator-(ExactTime lhs) noexcept
+    {
+        return lhs._value == std::numeric_limits<int64_t>::min()
+                   ? _invalid()
+                   : ExactTime{ -lhs._value, lhs };
+    }
+
+    /// @brief Add a time to this time.
+    constexpr ExactTime& operator+=(ExactTime other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    /// @brief Subtract a time from this time.
+    constexpr ExactTime& operator-=(ExactTime other) noexcept
+    {
+        return *this = *this - other;
+    }
+
+    /// @brief Return whether two times are the same instant, whatever
+    /// their rates.
+    ///
+    /// Like comparisons of NaN, comparisons with an invalid time are
+    /// false, apart from !=.  Times whose common rate overflows are
+    /// compared in seconds.
+    friend constexpr bool operator==(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        return _compare(lhs, rhs) == 0;
+    }
+
+    friend constexpr bool operator!=(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend constexpr bool operator<(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        return _compare(lhs, rhs) == -1;
+    }
+
+    friend constexpr bool operator>(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    friend constexpr bool operator<=(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        int const order = _compare(lhs, rhs);
+        return order == -1 || order == 0;
+    }
+
+    friend constexpr bool operator>=(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        return rhs <= lhs;
+    }
+
+private:
+    // a time with the given value at the rate of another, already reduced
+    constexpr ExactTime(int64_t value, ExactTime rate) noexcept
+        : _value{ value }
+        , _rate_num{ rate._rate_num }
+        , _rate_den{ rate._rate_den }
+    {}
+
+    static constexpr ExactTime _invalid() noexcept { return ExactTime{ 0, 0 }; }
+
+    // -1, 0 or 1 as lhs is before, at or after rhs; 2 if either is invalid
+    static constexpr int _compare(ExactTime lhs, ExactTime rhs) noexcept
+    {
+        if (lhs.is_invalid_time() || rhs.is_invalid_time())
+        {
+            return 2;
+        }
+
+        ExactTime const l = lhs.rescaled_to_common_rate(rhs);
+        ExactTime const r = rhs.rescaled_to_common_rate(lhs);
+        if (l.is_invalid_time() || r.is_invalid_time())
+        {
+            long double const l_seconds = (long double) lhs._value
+                                          * lhs._rate_den / lhs._rate_num;
+            long double const r_seconds = (long double) rhs._value
+                                          * rhs._rate_den / rhs._rate_num;
+            return l_seconds < r_seconds ? -1 : l_seconds > r_seconds ? 1 : 0;
+        }
+        return l._value < r._value ? -1 : l._value > r._value ? 1 : 0;
+    }
+
+    // Store a + b or a * b in result and return true, or return false if it
+    // would overflow.
+    static constexpr bool _add(int64_t a, int64_t b, int64_t* result) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_add_overflow(a, b, result);
+#else
+        if ((b > 0 && a > std::numeric_limits<int64_t>::max() - b)
+            || (b < 0 && a < std::numeric_limits<int64_t>::min() - b))
+        {
+            return false;
+        }
+        *result = a + b;
+        return true;
+#endif
+    }
+
+    static constexpr bool
+    _multiply(int64_t a, int64_t b, int64_t* result) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_mul_overflow(a, b, result);
+#else
+        constexpr int64_t max = std::numeric_limits<int64_t>::max();
+        constexpr int64_t min = std::numeric_limits<int64_t>::min();
+        if (a > 0 ? (b > 0 ? a > max / b : b < min / a)
+                  : (b > 0 ? a < min / b : (a != 0 && b < max / a)))
+        {
+            return false;
+        }
+        *result = a * b;
+        return true;
+#endif
+    }
+
+    int64_t _value;
+    int64_t _rate_num;
+    int64_t _rate_den;
+};
+
+}} // namespace opentime::OPENTIME_VERSION
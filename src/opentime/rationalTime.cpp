@@ -5,9 +5,10 @@
 #include "opentime/stringPrintf.h"
 #include <algorithm>
 #include <array>
+#include <cctype>
+#include <charconv>
 #include <ciso646>
 #include <cmath>
-#include <vector>
 
 namespace opentime { namespace OPENTIME_VERSION {
 
@@ -87,6 +88,111 @@ is_dropframe_rate(double rate)
     return std::find(b, e, rate) != e;
 }
 
+namespace {
+
+// Everything to_timecode() and to_timecodes() need to know about a rate.
+struct TimecodeFormat
+{
+    bool drop_frame;
+    char div;
+    int  dropframes;
+    int  nominal_fps;
+    int  frames_per_24_hours;
+    int  frames_per_10_minutes;
+    int  frames_per_minute;
+};
+
+} // namespace
+
+static bool
+timecode_format_for_rate(
+    double          rate,
+    IsDropFrameRate drop_frame,
+    TimecodeFormat* format,
+    ErrorStatus*    error_status)
+{
+    // It is common practice to use truncated or rounded values
+    // like 29.97 instead of exact SMPTE rates like 30000/1001
+    // so as a convenience we will snap the rate to the nearest
+    // SMPTE rate if it is close enough.
+    double nearest_smpte_rate = RationalTime::nearest_smpte_timecode_rate(rate);
+    if (abs(nearest_smpte_rate - rate) > 0.1)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(ErrorStatus::INVALID_TIMECODE_RATE);
+        }
+        return false;
+    }
+
+    // Let's assume this is the rate instead of the given rate.
+    rate = nearest_smpte_rate;
+
+    bool rate_is_dropframe = is_dropframe_rate(rate);
+    if (drop_frame == IsDropFrameRate::ForceYes and not rate_is_dropframe)
+    {
+        if (error_status)
+        {
+            *error_status =
+                ErrorStatus(ErrorStatus::INVALID_RATE_FOR_DROP_FRAME_TIMECODE);
+        }
+        return false;
+    }
+
+    if (drop_frame != IsDropFrameRate::InferFromRate)
+    {
+        if (drop_frame == IsDropFrameRate::ForceYes)
+        {
+            rate_is_dropframe = true;
+        }
+        else
+        {
+            rate_is_dropframe = false;
+        }
+    }
+
+    // extra math for dropframes stuff
+    int  dropframes = 0;
+    char div        = ':';
+    if (!rate_is_dropframe)
+    {
+        if (std::round(rate) == 24)
+        {
+            rate = 24.0;
+        }
+    }
+    else
+    {
+        if (rate == 30000 / 1001.0)
+        {
+            dropframes = 2;
+        }
+        else if (rate == 60000 / 1001.0)
+        {
+            dropframes = 4;
+        }
+        div = ';';
+    }
+
+    format->drop_frame  = rate_is_dropframe;
+    format->div         = div;
+    format->dropframes  = dropframes;
+    format->nominal_fps = static_cast<int>(std::ceil(rate));
+
+    // Number of frames in an hour
+    int frames_per_hour = static_cast<int>(std::round(rate * 60 * 60));
+    // Number of frames in a day - timecode rolls over after 24 hours
+    format->frames_per_24_hours = frames_per_hour * 24;
+    // Number of frames per ten minutes
+    format->frames_per_10_minutes =
+        static_cast<int>(std::round(rate * 60 * 10));
+    // Number of frames per minute is the round of the framerate * 60 minus
+    // the number of dropped frames
+    format->frames_per_minute =
+        static_cast<int>((std::round(rate) * 60) - dropframes);
+    return true;
+}
+
 static bool
 parseFloat(
     char const* pCurr,
@@ -94,7 +200,7 @@ parseFloat(
     bool        allow_negative,
     double*     result)
 {
-    if (pCurr >= pEnd || !pCurr)
+    if (!pCurr || pCurr > pEnd)
     {
         *result = 0.0;
         return false;
@@ -103,11 +209,11 @@ parseFloat(
     double ret  = 0.0;
     double sign = 1.0;
 
-    if (*pCurr == '+')
+    if (pCurr < pEnd && *pCurr == '+')
     {
         ++pCurr;
     }
-    else if (*pCurr == '-')
+    else if (pCurr < pEnd && *pCurr == '-')
     {
         if (!allow_negative)
         {
@@ -187,11 +293,30 @@ parseFloat(
     return true;
 }
 
+// Parse one field of a timecode the way std::stoi would, i.e. skipping
+// leading whitespace and accepting a sign, but without allocating or
+// throwing.
+static bool
+parse_timecode_field(std::string_view field, int* result)
+{
+    char const* begin = field.data();
+    char const* end   = begin + field.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(*begin)))
+    {
+        ++begin;
+    }
+    if (end - begin > 1 && begin[0] == '+' && begin[1] != '-')
+    {
+        ++begin;
+    }
+    return std::from_chars(begin, end, *result).ec == std::errc();
+}
+
 RationalTime
 RationalTime::from_timecode(
-    std::string const& timecode,
-    double             rate,
-    ErrorStatus*       error_status)
+    std::string_view timecode,
+    double           rate,
+    ErrorStatus*     error_status)
 {
     if (!RationalTime::is_smpte_timecode_rate(rate))
     {
@@ -204,7 +329,7 @@ RationalTime::from_timecode(
 
     bool rate_is_dropframe = is_dropframe_rate(rate);
 
-    if (timecode.find(';') != std::string::npos)
+    if (timecode.find(';') != std::string_view::npos)
     {
         if (!rate_is_dropframe)
         {
@@ -213,10 +338,11 @@ RationalTime::from_timecode(
                 *error_status = ErrorStatus(
                     ErrorStatus::INVALID_RATE_FOR_DROP_FRAME_TIMECODE,
                     string_printf(
-                        "Timecode '%s' indicates drop frame rate due "
+                        "Timecode '%.*s' indicates drop frame rate due "
                         "to the ';' frame divider. "
                         "Passed in rate %g is not a valid drop frame rate.",
-                        timecode.c_str(),
+                        static_cast<int>(timecode.size()),
+                        timecode.data(),
                         rate));
             }
             return RationalTime::_invalid_time;
@@ -227,37 +353,32 @@ RationalTime::from_timecode(
         rate_is_dropframe = false;
     }
 
-    std::vector<std::string> fields{ "", "", "", "" };
-    int                      hours, minutes, seconds, frames;
-
-    try
+    // the fields are two characters each, starting every three characters
+    int fields[4];
+    for (size_t i = 0; i < 4; i++)
     {
-        // split the fields
-        unsigned int last_pos = 0;
-        for (unsigned int i = 0; i < 4; i++)
+        size_t const pos = i * 3;
+        if (pos > timecode.size()
+            || !parse_timecode_field(timecode.substr(pos, 2), &fields[i]))
         {
-            fields[i] = timecode.substr(last_pos, 2);
-            last_pos  = last_pos + 3;
-        }
-
-        hours   = std::stoi(fields[0]);
-        minutes = std::stoi(fields[1]);
-        seconds = std::stoi(fields[2]);
-        frames  = std::stoi(fields[3]);
-    }
-    catch (std::exception const&)
-    {
-        if (error_status)
-        {
-            *error_status = ErrorStatus(
-                ErrorStatus::INVALID_TIMECODE_STRING,
-                string_printf(
-                    "Input timecode '%s' is an invalid timecode",
-                    timecode.c_str()));
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::INVALID_TIMECODE_STRING,
+                    string_printf(
+                        "Input timecode '%.*s' is an invalid timecode",
+                        static_cast<int>(timecode.size()),
+                        timecode.data()));
+            }
+            return RationalTime::_invalid_time;
         }
-        return RationalTime::_invalid_time;
     }
 
+    int const hours   = fields[0];
+    int const minutes = fields[1];
+    int const seconds = fields[2];
+    int const frames  = fields[3];
+
     const int nominal_fps = static_cast<int>(std::ceil(rate));
 
     if (frames >= nominal_fps)
@@ -267,9 +388,10 @@ RationalTime::from_timecode(
             *error_status = ErrorStatus(
                 ErrorStatus::TIMECODE_RATE_MISMATCH,
                 string_printf(
-                    "Frame rate mismatch.  Timecode '%s' has "
+                    "Frame rate mismatch.  Timecode '%.*s' has "
                     "frames beyond %d",
-                    timecode.c_str(),
+                    static_cast<int>(timecode.size()),
+                    timecode.data(),
                     nominal_fps - 1));
         }
         return RationalTime::_invalid_time;
@@ -303,7 +425,7 @@ RationalTime::from_timecode(
 
 static void
 set_error(
-    std::string const&   time_string,
+    std::string_view     time_string,
     ErrorStatus::Outcome code,
     ErrorStatus*         err)
 {
@@ -312,17 +434,18 @@ set_error(
         *err = ErrorStatus(
             code,
             string_printf(
-                "Error: '%s' - %s",
-                time_string.c_str(),
+                "Error: '%.*s' - %s",
+                static_cast<int>(time_string.size()),
+                time_string.data(),
                 ErrorStatus::outcome_to_string(code).c_str()));
     }
 }
 
 RationalTime
 RationalTime::from_time_string(
-    std::string const& time_string,
-    double             rate,
-    ErrorStatus*       error_status)
+    std::string_view time_string,
+    double           rate,
+    ErrorStatus*     error_status)
 {
     if (!RationalTime::is_smpte_timecode_rate(rate))
     {
@@ -333,11 +456,13 @@ RationalTime::from_time_string(
         return RationalTime::_invalid_time;
     }
 
+    // The string is scanned backwards from one past its end, which is
+    // treated as if it held a terminating null.
     const char* start          = time_string.data();
     const char* end            = start + time_string.length();
-    char*       current        = const_cast<char*>(end);
-    char*       parse_end      = current;
-    char*       prev_parse_end = current;
+    const char* current        = end;
+    const char* parse_end      = current;
+    const char* prev_parse_end = current;
 
     double power[3] = {
         1.0,   // seconds
@@ -349,10 +474,10 @@ RationalTime::from_time_string(
     int    radix       = 0;
     while (start <= current)
     {
-        if (*current == ':')
+        if (current < end && *current == ':')
         {
             parse_end = current + 1;
-            char c    = *parse_end;
+            char c    = parse_end < end ? *parse_end : '\0';
             if (c != '\0' && c != ':')
             {
                 if (c < '0' || c > '9')
@@ -364,7 +489,11 @@ RationalTime::from_time_string(
                     return RationalTime::_invalid_time;
                 }
                 double val = 0.0;
-                if (!parseFloat(parse_end, prev_parse_end + 1, false, &val))
+                if (!parseFloat(
+                        parse_end,
+                        std::min(prev_parse_end + 1, end),
+                        false,
+                        &val))
                 {
                     set_error(
                         time_string,
@@ -409,7 +538,11 @@ RationalTime::from_time_string(
             if (prev_parse_end)
             {
                 double val = 0.0;
-                if (!parseFloat(start, prev_parse_end + 1, true, &val))
+                if (!parseFloat(
+                        start,
+                        std::min(prev_parse_end + 1, end),
+                        true,
+                        &val))
                 {
                     set_error(
                         time_string,
@@ -453,79 +586,17 @@ RationalTime::to_timecode(
         return std::string();
     }
 
-    // It is common practice to use truncated or rounded values
-    // like 29.97 instead of exact SMPTE rates like 30000/1001
-    // so as a convenience we will snap the rate to the nearest
-    // SMPTE rate if it is close enough.
-    double nearest_smpte_rate = nearest_smpte_timecode_rate(rate);
-    if (abs(nearest_smpte_rate - rate) > 0.1)
+    TimecodeFormat format;
+    if (!timecode_format_for_rate(rate, drop_frame, &format, error_status))
     {
-        if (error_status)
-        {
-            *error_status = ErrorStatus(ErrorStatus::INVALID_TIMECODE_RATE);
-        }
         return std::string();
     }
 
-    // Let's assume this is the rate instead of the given rate.
-    rate = nearest_smpte_rate;
-
-    bool rate_is_dropframe = is_dropframe_rate(rate);
-    if (drop_frame == IsDropFrameRate::ForceYes and not rate_is_dropframe)
-    {
-        if (error_status)
-        {
-            *error_status =
-                ErrorStatus(ErrorStatus::INVALID_RATE_FOR_DROP_FRAME_TIMECODE);
-        }
-        return std::string();
-    }
-
-    if (drop_frame != IsDropFrameRate::InferFromRate)
-    {
-        if (drop_frame == IsDropFrameRate::ForceYes)
-        {
-            rate_is_dropframe = true;
-        }
-        else
-        {
-            rate_is_dropframe = false;
-        }
-    }
-
-    // extra math for dropframes stuff
-    int  dropframes = 0;
-    char div        = ':';
-    if (!rate_is_dropframe)
-    {
-        if (std::round(rate) == 24)
-        {
-            rate = 24.0;
-        }
-    }
-    else
-    {
-        if (rate == 30000 / 1001.0)
-        {
-            dropframes = 2;
-        }
-        else if (rate == 60000 / 1001.0)
-        {
-            dropframes = 4;
-        }
-        div = ';';
-    }
-
-    // Number of frames in an hour
-    int frames_per_hour = static_cast<int>(std::round(rate * 60 * 60));
-    // Number of frames in a day - timecode rolls over after 24 hours
-    int frames_per_24_hours = frames_per_hour * 24;
-    // Number of frames per ten minutes
-    int frames_per_10_minutes = static_cast<int>(std::round(rate * 60 * 10));
-    // Number of frames per minute is the round of the framerate * 60 minus
-    // the number of dropped frames
-    int frames_per_minute =
-        static_cast<int>((std::round(rate) * 60) - dropframes);
+    bool const rate_is_dropframe     = format.drop_frame;
+    int const  dropframes            = format.dropframes;
+    int const  frames_per_24_hours   = format.frames_per_24_hours;
+    int const  frames_per_10_minutes = format.frames_per_10_minutes;
+    int const  frames_per_minute     = format.frames_per_minute;
 
     // If the number of frames is more than 24 hours, roll over clock
     double value = std::fmod(frames_in_target_rate, frames_per_24_hours);
@@ -551,7 +622,7 @@ RationalTime::to_timecode(
         }
     }
 
-    int nominal_fps = static_cast<int>(std::ceil(rate));
+    int nominal_fps = format.nominal_fps;
 
     // compute the fields
     int frames        = static_cast<int>(std::fmod(value, nominal_fps));
@@ -567,7 +638,7 @@ RationalTime::to_timecode(
         hours,
         minutes,
         seconds,
-        div,
+        format.div,
         frames);
 }
 
@@ -591,6 +662,200 @@ RationalTime::to_nearest_timecode(
     return result;
 }
 
+// Write a value below 100 as two digits.
+static inline void
+write_two_digits(char* out, int64_t value)
+{
+    out[0] = static_cast<char>('0' + value / 10);
+    out[1] = static_cast<char>('0' + value % 10);
+}
+
+// Read two digits, returning -1 if either is not a digit.
+static inline int
+read_two_digits(char const* in)
+{
+    unsigned const tens = static_cast<unsigned char>(in[0]) - '0';
+    unsigned const ones = static_cast<unsigned char>(in[1]) - '0';
+    return (tens > 9 || ones > 9) ? -1 : static_cast<int>(tens * 10 + ones);
+}
+
+bool
+RationalTime::to_timecodes(
+    int64_t const*  frames,
+    size_t          count,
+    double          rate,
+    IsDropFrameRate drop_frame,
+    char*           buffer,
+    ErrorStatus*    error_status)
+{
+    if (error_status)
+    {
+        *error_status = ErrorStatus();
+    }
+
+    TimecodeFormat format;
+    if (!timecode_format_for_rate(rate, drop_frame, &format, error_status))
+    {
+        return false;
+    }
+
+    // The same arithmetic as to_timecode(), but on integers, and with the
+    // drop frame compensation folded into a single expression so that the
+    // loop body does not branch on it.
+    int64_t const dropframes            = format.dropframes;
+    int64_t const frames_per_24_hours   = format.frames_per_24_hours;
+    int64_t const frames_per_10_minutes = format.frames_per_10_minutes;
+    int64_t const frames_per_minute     = format.frames_per_minute;
+    int64_t const nominal_fps           = format.nominal_fps;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (frames[i] < 0)
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::NEGATIVE_VALUE,
+                    string_printf(
+                        "Frame %lld at index %zu is negative",
+                        static_cast<long long>(frames[i]),
+                        i));
+            }
+            return false;
+        }
+
+        int64_t value = frames[i] % frames_per_24_hours;
+
+        int64_t const ten_minute_chunks = value / frames_per_10_minutes;
+        int64_t const frames_over_ten_minutes =
+            value % frames_per_10_minutes;
+        int64_t const minutes_dropped =
+            (frames_over_ten_minutes > dropframes)
+                ? (frames_over_ten_minutes - dropframes) / frames_per_minute
+                : 0;
+        value += dropframes * (9 * ten_minute_chunks + minutes_dropped);
+
+        int64_t const seconds_total = value / nominal_fps;
+
+        char* out = buffer + i * timecode_length;
+        write_two_digits(out, seconds_total / 3600);
+        out[2] = ':';
+        write_two_digits(out + 3, (seconds_total / 60) % 60);
+        out[5] = ':';
+        write_two_digits(out + 6, seconds_total % 60);
+        out[8] = format.div;
+        write_two_digits(out + 9, value % nominal_fps);
+    }
+
+    return true;
+}
+
+bool
+RationalTime::from_timecodes(
+    char const*  buffer,
+    size_t       count,
+    double       rate,
+    int64_t*     frames,
+    ErrorStatus* error_status)
+{
+    if (error_status)
+    {
+        *error_status = ErrorStatus();
+    }
+
+    if (!RationalTime::is_smpte_timecode_rate(rate))
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus{ ErrorStatus::INVALID_TIMECODE_RATE };
+        }
+        return false;
+    }
+
+    bool const rate_is_dropframe = is_dropframe_rate(rate);
+    int const  nominal_fps       = static_cast<int>(std::ceil(rate));
+
+    int rate_dropframes = 0;
+    if (rate == 30000 / 1001.0)
+    {
+        rate_dropframes = 2;
+    }
+    else if (rate == 60000 / 1001.0)
+    {
+        rate_dropframes = 4;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        char const* in = buffer + i * timecode_length;
+
+        int const hours   = read_two_digits(in);
+        int const minutes = read_two_digits(in + 3);
+        int const seconds = read_two_digits(in + 6);
+        int const frame   = read_two_digits(in + 9);
+
+        bool const is_dropframe = in[8] == ';';
+        if (hours < 0 || minutes < 0 || seconds < 0 || frame < 0
+            || in[2] != ':' || in[5] != ':' || (in[8] != ':' && !is_dropframe))
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::INVALID_TIMECODE_STRING,
+                    string_printf(
+                        "Input timecode '%.*s' at index %zu is an invalid "
+                        "timecode",
+                        static_cast<int>(timecode_length),
+                        in,
+                        i));
+            }
+            return false;
+        }
+
+        if (is_dropframe && !rate_is_dropframe)
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::INVALID_RATE_FOR_DROP_FRAME_TIMECODE,
+                    string_printf(
+                        "Timecode '%.*s' at index %zu indicates drop frame "
+                        "rate due to the ';' frame divider. "
+                        "Passed in rate %g is not a valid drop frame rate.",
+                        static_cast<int>(timecode_length),
+                        in,
+                        i,
+                        rate));
+            }
+            return false;
+        }
+
+        if (frame >= nominal_fps)
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::TIMECODE_RATE_MISMATCH,
+                    string_printf(
+                        "Frame rate mismatch.  Timecode '%.*s' at index %zu "
+                        "has frames beyond %d",
+                        static_cast<int>(timecode_length),
+                        in,
+                        i,
+                        nominal_fps - 1));
+            }
+            return false;
+        }
+
+        int64_t const dropframes    = is_dropframe ? rate_dropframes : 0;
+        int64_t const total_minutes = hours * 60 + minutes;
+        frames[i] = (total_minutes * 60 + seconds) * nominal_fps + frame
+                    - dropframes * (total_minutes - total_minutes / 10);
+    }
+
+    return true;
+}
+
 std::string
 RationalTime::to_time_string() const
 {
@@ -6,9 +6,11 @@
 #include "opentime/errorStatus.h"
 #include "opentime/version.h"
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <string_view>
 
 namespace opentime { namespace OPENTIME_VERSION {
 
@@ -207,13 +209,16 @@ public:
 
     /// @brief Convert a timecode string ("HH:MM:SS;FRAME") into a time.
     ///
+    /// The timecode need not be null terminated, and parsing does not
+    /// allocate or throw; errors are only reported through error_status.
+    ///
     /// @param timecode The timecode string.
     /// @param rate The timecode rate.
     /// @param error_status Optional error status.
     static RationalTime from_timecode(
-        std::string const& timecode,
-        double             rate,
-        ErrorStatus*       error_status = nullptr);
+        std::string_view timecode,
+        double           rate,
+        ErrorStatus*     error_status = nullptr);
 
     /// @brief Parse a string in the form "hours:minutes:seconds".
     ///
@@ -221,13 +226,16 @@ public:
     ///
     /// Seconds may have up to microsecond precision.
     ///
+    /// As with from_timecode(), the string need not be null terminated and
+    /// parsing does not allocate or throw.
+    ///
     /// @param time_string The time string.
     /// @param rate The time rate.
     /// @param error_status Optional error status.
     static RationalTime from_time_string(
-        std::string const& time_string,
-        double             rate,
-        ErrorStatus*       error_status = nullptr);
+        std::string_view time_string,
+        double           rate,
+        ErrorStatus*     error_status = nullptr);
 
     /// @brief Returns the frame number based on the current rate.
     constexpr int to_frames() const noexcept { return int(_value); }
@@ -286,10 +294,62 @@ public:
     /// @return The time string, which may have a leading negative sign.
     std::string to_time_string() const;
 
+    /// @brief The number of characters in a timecode written by
+    /// to_timecodes() or read by from_timecodes(), e.g. "HH:MM:SS:FF".
+    static constexpr size_t timecode_length = 11;
+
+    /// @brief Convert an array of frame numbers to timecode.
+    ///
+    /// This is the batch form of to_timecode() for frame numbers counted at
+    /// the timecode rate. Each timecode is written as exactly
+    /// timecode_length characters, with no separator or terminator, so the
+    /// i'th timecode starts at buffer + i * timecode_length. Nothing is
+    /// allocated, and the rate is only validated once.
+    ///
+    /// @param frames The frame numbers.
+    /// @param count The number of frame numbers.
+    /// @param rate The timecode rate.
+    /// @param drop_frame Whether to use drop frame timecode.
+    /// @param buffer The output, at least count * timecode_length chars.
+    /// @param error_status Optional error status.
+    /// @return false on error, in which case the timecodes from the
+    /// offending frame on are not written.
+    static bool to_timecodes(
+        int64_t const*  frames,
+        size_t          count,
+        double          rate,
+        IsDropFrameRate drop_frame,
+        char*           buffer,
+        ErrorStatus*    error_status = nullptr);
+
+    /// @brief Convert an array of timecodes to frame numbers.
+    ///
+    /// This is the batch form of from_timecode(). The timecodes are read
+    /// from consecutive slots of timecode_length characters, as written by
+    /// to_timecodes(); a ';' frame divider marks a drop frame timecode.
+    ///
+    /// @param buffer The timecodes, count * timecode_length chars.
+    /// @param count The number of timecodes.
+    /// @param rate The timecode rate.
+    /// @param frames The output frame numbers, at least count of them.
+    /// @param error_status Optional error status.
+    /// @return false on error, in which case the frame numbers from the
+    /// offending timecode on are not written.
+    static bool from_timecodes(
+        char const*  buffer,
+        size_t       count,
+        double       rate,
+        int64_t*     frames,
+        ErrorStatus* error_status = nullptr);
+
     /// @brief Add a time to this time.
     constexpr RationalTime const& operator+=(RationalTime other) noexcept
     {
-        if (_rate < other._rate)
+        if (_rate == other._rate)
+        {
+            _value += other._value;
+        }
+        else if (_rate < other._rate)
         {
             _value = other._value + value_rescaled_to(other._rate);
             _rate  = other._rate;
@@ -304,7 +364,11 @@ public:
     /// @brief Subtract a time from this time.
     constexpr RationalTime const& operator-=(RationalTime other) noexcept
     {
-        if (_rate < other._rate)
+        if (_rate == other._rate)
+        {
+            _value -= other._value;
+        }
+        else if (_rate < other._rate)
         {
             _value = value_rescaled_to(other._rate) - other._value;
             _rate  = other._rate;
@@ -320,6 +384,10 @@ public:
     friend constexpr RationalTime
     operator+(RationalTime lhs, RationalTime rhs) noexcept
     {
+        if (lhs._rate == rhs._rate)
+        {
+            return RationalTime{ lhs._value + rhs._value, lhs._rate };
+        }
         return (lhs._rate < rhs._rate)
                    ? RationalTime{ lhs.value_rescaled_to(rhs._rate)
                                        + rhs._value,
@@ -333,6 +401,10 @@ public:
     friend constexpr RationalTime
     operator-(RationalTime lhs, RationalTime rhs) noexcept
     {
+        if (lhs._rate == rhs._rate)
+        {
+            return RationalTime{ lhs._value - rhs._value, lhs._rate };
+        }
         return (lhs._rate < rhs._rate)
                    ? RationalTime{ lhs.value_rescaled_to(rhs._rate)
                                        - rhs._value,
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentime/rationalTimeArray.h"
+#include <algorithm>
+
+namespace opentime { namespace OPENTIME_VERSION {
+
+// The loops below are written without early exits or calls, and both arms
+// of each conditional in the scalar code are computed before selecting
+// one, so that they vectorize.  They must stay bit for bit identical to the
+// RationalTime operators.
+
+namespace {
+
+// The value of RationalTime{ value, rate } + RationalTime{ other_value,
+// other_rate }; the rate of the sum is the greater of the two.
+inline double
+sum_value(
+    double value,
+    double rate,
+    double other_value,
+    double other_rate) noexcept
+{
+    double const rescaled       = value * other_rate / rate;
+    double const other_rescaled = other_value * rate / other_rate;
+    return rate < other_rate
+               ? rescaled + other_value
+               : (other_rate == rate ? other_value : other_rescaled) + value;
+}
+
+} // namespace
+
+void
+RationalTimeArray::rescale_to(double new_rate) noexcept
+{
+    double*      values = _values.data();
+    double*      rates  = _rates.data();
+    size_t const count  = _values.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        double const rescaled = values[i] * new_rate / rates[i];
+        values[i] = rates[i] == new_rate ? values[i] : rescaled;
+        rates[i]  = new_rate;
+    }
+}
+
+void
+RationalTimeArray::add(RationalTime other) noexcept
+{
+    double*      values      = _values.data();
+    double*      rates       = _rates.data();
+    size_t const count       = _values.size();
+    double const other_value = other.value();
+    double const other_rate  = other.rate();
+    for (size_t i = 0; i < count; ++i)
+    {
+        values[i] = sum_value(values[i], rates[i], other_value, other_rate);
+        rates[i]  = rates[i] < other_rate ? other_rate : rates[i];
+    }
+}
+
+void
+RationalTimeArray::add(RationalTimeArray const& other) noexcept
+{
+    double*       values       = _values.data();
+    double*       rates        = _rates.data();
+    double const* other_values = other._values.data();
+    double const* other_rates  = other._rates.data();
+    size_t const  count        = std::min(_values.size(), other._values.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+        values[i] =
+            sum_value(values[i], rates[i], other_values[i], other_rates[i]);
+        rates[i] = rates[i] < other_rates[i] ? other_rates[i] : rates[i];
+    }
+}
+
+size_t
+RationalTimeArray::less_than(RationalTime other, uint8_t* result) const noexcept
+{
+    double const* values  = _values.data();
+    double const* rates   = _rates.data();
+    size_t const  count   = _values.size();
+    double const  seconds = other.value() / other.rate();
+    size_t        matches = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const match = !(values[i] / rates[i] >= seconds);
+        result[i]           = match;
+        matches += match;
+    }
+    return matches;
+}
+
+size_t
+RationalTimeArray::greater_than(RationalTime other, uint8_t* result)
+    const noexcept
+{
+    double const* values  = _values.data();
+    double const* rates   = _rates.data();
+    size_t const  count   = _values.size();
+    double const  seconds = other.value() / other.rate();
+    size_t        matches = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const match = values[i] / rates[i] > seconds;
+        result[i]           = match;
+        matches += match;
+    }
+    return matches;
+}
+
+RationalTimeArray
+RationalTimeArray::cumulative_sum(RationalTime start) const
+{
+    // Each sum depends on the one before, so this cannot be vectorized,
+    // but it still avoids building a RationalTime per element.
+    size_t const      count = _values.size();
+    RationalTimeArray result(count + 1);
+    double*           out_values = result._values.data();
+    double*           out_rates  = result._rates.data();
+
+    double total_value = start.value();
+    double total_rate  = start.rate();
+    out_values[0]      = total_value;
+    out_rates[0]       = total_rate;
+    for (size_t i = 0; i < count; ++i)
+    {
+        total_value = sum_value(total_value, total_rate, _values[i], _rates[i]);
+        total_rate  = total_rate < _rates[i] ? _rates[i] : total_rate;
+        out_values[i + 1] = total_value;
+        out_rates[i + 1]  = total_rate;
+    }
+    return result;
+}
+
+}} // namespace opentime::OPENTIME_VERSION
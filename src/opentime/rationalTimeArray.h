@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentime/rationalTime.h"
+#include "opentime/version.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opentime { namespace OPENTIME_VERSION {
+
+/// @brief This class represents an array of times.
+///
+/// The values and rates are stored in two separate contiguous arrays rather
+/// than as an array of RationalTime, so the bulk operations below run as
+/// simple loops over doubles that the compiler can vectorize. Every
+/// operation gives exactly the same result, element by element, as the
+/// corresponding RationalTime operation.
+class RationalTimeArray
+{
+public:
+    RationalTimeArray() = default;
+
+    /// @brief Construct an array of size zero times at the given rate.
+    explicit RationalTimeArray(size_t size, double rate = 1)
+        : _values(size, 0)
+        , _rates(size, rate)
+    {}
+
+    /// @brief Returns the number of times.
+    size_t size() const noexcept { return _values.size(); }
+
+    /// @brief Returns whether there are no times.
+    bool empty() const noexcept { return _values.empty(); }
+
+    /// @brief Reserve storage for at least size times.
+    void reserve(size_t size)
+    {
+        _values.reserve(size);
+        _rates.reserve(size);
+    }
+
+    /// @brief Remove all of the times.
+    void clear() noexcept
+    {
+        _values.clear();
+        _rates.clear();
+    }
+
+    /// @brief Append a time.
+    void push_back(RationalTime time)
+    {
+        _values.push_back(time.value());
+        _rates.push_back(time.rate());
+    }
+
+    /// @brief Returns the time at the given index.
+    RationalTime operator[](size_t index) const noexcept
+    {
+        return RationalTime{ _values[index], _rates[index] };
+    }
+
+    /// @brief Set the time at the given index.
+    void set(size_t index, RationalTime time) noexcept
+    {
+        _values[index] = time.value();
+        _rates[index]  = time.rate();
+    }
+
+    /// @brief Returns the array of values.
+    double const* values() const noexcept { return _values.data(); }
+
+    /// @brief Returns the array of values.
+    double* values() noexcept { return _values.data(); }
+
+    /// @brief Returns the array of rates.
+    double const* rates() const noexcept { return _rates.data(); }
+
+    /// @brief Returns the array of rates.
+    double* rates() noexcept { return _rates.data(); }
+
+    /// @brief Convert every time to a new rate, as RationalTime::rescaled_to().
+    void rescale_to(double new_rate) noexcept;
+
+    /// @brief Add a time to every time, as RationalTime::operator+().
+    void add(RationalTime other) noexcept;
+
+    /// @brief Add the times of another array to these times, element by
+    /// element, as RationalTime::operator+().
+    ///
+    /// Only the first min(size(), other.size()) times are changed.
+    void add(RationalTimeArray const& other) noexcept;
+
+    /// @brief Compare every time against another time, as
+    /// RationalTime::operator<().
+    ///
+    /// @param other The time to compare against.
+    /// @param result The output, at least size() elements; each is 1 if
+    /// the time is less than other and 0 otherwise.
+    /// @return The number of times that are less than other.
+    size_t less_than(RationalTime other, uint8_t* result) const noexcept;
+
+    /// @brief Compare every time against another time, as
+    /// RationalTime::operator>().
+    ///
+    /// @param other The time to compare against.
+    /// @param result The output, at least size() elements; each is 1 if
+    /// the time is greater than other and 0 otherwise.
+    /// @return The number of times that are greater than other.
+    size_t greater_than(RationalTime other, uint8_t* result) const noexcept;
+
+    /// @brief Returns the running sums of these times, starting at start.
+    ///
+    /// The result has size() + 1 elements: the i'th is the sum of start and
+    /// the first i times, accumulated from left to right with
+    /// RationalTime::operator+(). When the times are durations, these are
+    /// the start times of consecutive ranges followed by the end time of the
+    /// last one.
+    RationalTimeArray cumulative_sum(RationalTime start) const;
+
+private:
+    std::vector<double> _values;
+    std::vector<double> _rates;
+};
+
+}} // namespace opentime::OPENTIME_VERSION
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentime/timeRangeArray.h"
+
+namespace opentime { namespace OPENTIME_VERSION {
+
+// As in rationalTimeArray.cpp, these loops must stay bit for bit identical
+// to the TimeRange operations they mirror; in particular, to_seconds() is
+// value / rate, and the end of a range is at the rate of its duration.
+
+namespace {
+
+inline double
+end_value(
+    double start_value,
+    double start_rate,
+    double duration_value,
+    double duration_rate) noexcept
+{
+    // Always computing the rescaled value, rather than only when the rates
+    // differ, leaves a select that the compiler can vectorize.
+    double const rescaled = start_value * duration_rate / start_rate;
+    return (start_rate == duration_rate ? start_value : rescaled)
+           + duration_value;
+}
+
+} // namespace
+
+TimeRangeArray
+TimeRangeArray::from_durations(
+    RationalTime             start,
+    RationalTimeArray const& durations)
+{
+    size_t const   count = durations.size();
+    TimeRangeArray result;
+    result._start_times = RationalTimeArray(count);
+    result._durations   = durations;
+    result._start_seconds.resize(count);
+    result._end_seconds.resize(count);
+
+    // Each start is the end of the range before, so this cannot be
+    // vectorized.
+    double*       start_values    = result._start_times.values();
+    double*       start_rates     = result._start_times.rates();
+    double const* duration_values = durations.values();
+    double const* duration_rates  = durations.rates();
+
+    double last_end_value = start.value();
+    double last_end_rate  = start.rate();
+    for (size_t i = 0; i < count; ++i)
+    {
+        start_values[i] = last_end_value;
+        start_rates[i]  = last_end_rate;
+        last_end_value  = end_value(
+            last_end_value,
+            last_end_rate,
+            duration_values[i],
+            duration_rates[i]);
+        last_end_rate = duration_rates[i];
+    }
+
+    result.update_seconds();
+    return result;
+}
+
+void
+TimeRangeArray::rescale_to(double new_rate) noexcept
+{
+    _start_times.rescale_to(new_rate);
+    _durations.rescale_to(new_rate);
+    update_seconds();
+}
+
+RationalTimeArray
+TimeRangeArray::end_times_exclusive() const
+{
+    size_t const      count = size();
+    RationalTimeArray result(count);
+    double*           out_values      = result.values();
+    double*           out_rates       = result.rates();
+    double const*     start_values    = _start_times.values();
+    double const*     start_rates     = _start_times.rates();
+    double const*     duration_values = _durations.values();
+    double const*     duration_rates  = _durations.rates();
+    for (size_t i = 0; i < count; ++i)
+    {
+        out_values[i] = end_value(
+            start_values[i],
+            start_rates[i],
+            duration_values[i],
+            duration_rates[i]);
+        out_rates[i] = duration_rates[i];
+    }
+    return result;
+}
+
+size_t
+TimeRangeArray::contains(RationalTime other, uint8_t* result) const noexcept
+{
+    size_t const  count   = size();
+    double const* starts  = _start_seconds.data();
+    double const* ends    = _end_seconds.data();
+    double const  seconds = other.to_seconds();
+    size_t        matches = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const match = !(starts[i] > seconds) & !(seconds >= ends[i]);
+        result[i]           = match;
+        matches += match;
+    }
+    return matches;
+}
+
+size_t
+TimeRangeArray::contains(
+    TimeRange other,
+    uint8_t*  result,
+    double    epsilon_s) const noexcept
+{
+    size_t const  count       = size();
+    double const* starts      = _start_seconds.data();
+    double const* ends        = _end_seconds.data();
+    double const  other_start = other.start_time().to_seconds();
+    double const  other_end   = other.end_time_exclusive().to_seconds();
+    size_t        matches     = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const match = (other_start - starts[i] >= epsilon_s)
+                              & (ends[i] - other_end >= epsilon_s);
+        result[i] = match;
+        matches += match;
+    }
+    return matches;
+}
+
+size_t
+TimeRangeArray::overlaps(
+    TimeRange other,
+    uint8_t*  result,
+    double    epsilon_s) const noexcept
+{
+    size_t const  count       = size();
+    double const* starts      = _start_seconds.data();
+    double const* ends        = _end_seconds.data();
+    double const  other_start = other.start_time().to_seconds();
+    double const  other_end   = other.end_time_exclusive().to_seconds();
+    size_t        matches     = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const match = (other_start - starts[i] >= epsilon_s)
+                              & (ends[i] - other_start >= epsilon_s)
+                              & (other_end - ends[i] >= epsilon_s);
+        result[i] = match;
+        matches += match;
+    }
+    return matches;
+}
+
+size_t
+TimeRangeArray::intersects(
+    TimeRange other,
+    uint8_t*  result,
+    double    epsilon_s) const noexcept
+{
+    size_t const  count       = size();
+    double const* starts      = _start_seconds.data();
+    double const* ends        = _end_seconds.data();
+    double const  other_start = other.start_time().to_seconds();
+    double const  other_end   = other.end_time_exclusive().to_seconds();
+    size_t        matches     = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const match = (other_end - starts[i] >= epsilon_s)
+                              & (ends[i] - other_start >= epsilon_s);
+        result[i] = match;
+        matches += match;
+    }
+    return matches;
+}
+
+void
+TimeRangeArray::update_seconds() noexcept
+{
+    size_t const  count           = size();
+    double*       starts          = _start_seconds.data();
+    double*       ends            = _end_seconds.data();
+    double const* start_values    = _start_times.values();
+    double const* start_rates     = _start_times.rates();
+    double const* duration_values = _durations.values();
+    double const* duration_rates  = _durations.rates();
+    for (size_t i = 0; i < count; ++i)
+    {
+        starts[i] = start_values[i] / start_rates[i];
+        ends[i]   = end_value(
+                      start_values[i],
+                      start_rates[i],
+                      duration_values[i],
+                      duration_rates[i])
+                  / duration_rates[i];
+    }
+}
+
+}} // namespace opentime::OPENTIME_VERSION
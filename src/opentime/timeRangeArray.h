@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentime/rationalTimeArray.h"
+#include "opentime/timeRange.h"
+#include "opentime/version.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opentime { namespace OPENTIME_VERSION {
+
+/// @brief This class represents an array of time ranges.
+///
+/// The start times and durations are each stored as a RationalTimeArray.
+/// Alongside them the array keeps the start and exclusive end of every
+/// range in seconds, which is what the TimeRange predicates compare, so
+/// that queries over many ranges, such as finding every clip that is active
+/// at a playhead, are a vectorizable loop of comparisons. Every operation
+/// gives exactly the same result, element by element, as the corresponding
+/// TimeRange operation.
+class TimeRangeArray
+{
+public:
+    TimeRangeArray() = default;
+
+    /// @brief Returns the number of ranges.
+    size_t size() const noexcept { return _start_seconds.size(); }
+
+    /// @brief Returns whether there are no ranges.
+    bool empty() const noexcept { return _start_seconds.empty(); }
+
+    /// @brief Reserve storage for at least size ranges.
+    void reserve(size_t size)
+    {
+        _start_times.reserve(size);
+        _durations.reserve(size);
+        _start_seconds.reserve(size);
+        _end_seconds.reserve(size);
+    }
+
+    /// @brief Remove all of the ranges.
+    void clear() noexcept
+    {
+        _start_times.clear();
+        _durations.clear();
+        _start_seconds.clear();
+        _end_seconds.clear();
+    }
+
+    /// @brief Append a range.
+    void push_back(TimeRange range)
+    {
+        _start_times.push_back(range.start_time());
+        _durations.push_back(range.duration());
+        _start_seconds.push_back(range.start_time().to_seconds());
+        _end_seconds.push_back(range.end_time_exclusive().to_seconds());
+    }
+
+    /// @brief Returns the range at the given index.
+    TimeRange operator[](size_t index) const noexcept
+    {
+        return TimeRange{ _start_times[index], _durations[index] };
+    }
+
+    /// @brief Set the range at the given index.
+    void set(size_t index, TimeRange range) noexcept
+    {
+        _start_times.set(index, range.start_time());
+        _durations.set(index, range.duration());
+        _start_seconds[index] = range.start_time().to_seconds();
+        _end_seconds[index]   = range.end_time_exclusive().to_seconds();
+    }
+
+    /// @brief Returns the start times.
+    RationalTimeArray const& start_times() const noexcept
+    {
+        return _start_times;
+    }
+
+    /// @brief Returns the durations.
+    RationalTimeArray const& durations() const noexcept { return _durations; }
+
+    /// @brief Returns the start time of every range in seconds.
+    double const* start_seconds() const noexcept
+    {
+        return _start_seconds.data();
+    }
+
+    /// @brief Returns the exclusive end time of every range in seconds.
+    double const* end_seconds() const noexcept { return _end_seconds.data(); }
+
+    /// @brief Returns ranges laid end to end from start, one per duration,
+    /// in the same way that Track lays out its children.
+    static TimeRangeArray
+    from_durations(RationalTime start, RationalTimeArray const& durations);
+
+    /// @brief Convert the start time and duration of every range to a new
+    /// rate.
+    void rescale_to(double new_rate) noexcept;
+
+    /// @brief Returns the exclusive end time of every range, as
+    /// TimeRange::end_time_exclusive().
+    RationalTimeArray end_times_exclusive() const;
+
+    /// @brief Test whether every range contains a time, as
+    /// TimeRange::contains(RationalTime).
+    ///
+    /// @param other The time, such as a playhead.
+    /// @param result The output, at least size() elements; each is 1 if
+    /// the range contains other and 0 otherwise.
+    /// @return The number of ranges that contain other.
+    size_t contains(RationalTime other, uint8_t* result) const noexcept;
+
+    /// @brief Test whether every range contains another range, as
+    /// TimeRange::contains(TimeRange, double).
+    ///
+    /// @param other The other range.
+    /// @param result The output, at least size() elements.
+    /// @param epsilon_s The tolerance in seconds.
+    /// @return The number of ranges that contain other.
+    size_t contains(
+        TimeRange other,
+        uint8_t*  result,
+        double    epsilon_s = DEFAULT_EPSILON_s) const noexcept;
+
+    /// @brief Test whether every range overlaps another range, as
+    /// TimeRange::overlaps(TimeRange, double).
+    ///
+    /// @param other The other range.
+    /// @param result The output, at least size() elements.
+    /// @param epsilon_s The tolerance in seconds.
+    /// @return The number of ranges that overlap other.
+    size_t overlaps(
+        TimeRange other,
+        uint8_t*  result,
+        double    epsilon_s = DEFAULT_EPSILON_s) const noexcept;
+
+    /// @brief Test whether every range intersects another range, as
+    /// TimeRange::intersects(TimeRange, double).
+    ///
+    /// @param other The other range.
+    /// @param result The output, at least size() elements.
+    /// @param epsilon_s The tolerance in seconds.
+    /// @return The number of ranges that intersect other.
+    size_t intersects(
+        TimeRange other,
+        uint8_t*  result,
+        double    epsilon_s = DEFAULT_EPSILON_s) const noexcept;
+
+private:
+    void update_seconds() noexcept;
+
+    RationalTimeArray   _start_times;
+    RationalTimeArray   _durations;
+    std::vector<double> _start_seconds;
+    std::vector<double> _end_seconds;
+};
+
+}} // namespace opentime::OPENTIME_VERSION
@@ -5,20 +5,37 @@
 
 #include "opentimelineio/version.h"
 
+#if defined(OTIO_FLAT_ANY_DICTIONARY)
+#    include "opentimelineio/flatStringMap.h"
+#endif
+
 #include <any>
 #include <assert.h>
 #include <map>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+// The storage behind AnyDictionary.  Building with the CMake option
+// OTIO_FLAT_ANY_DICTIONARY selects a sorted vector (see FlatStringMap),
+// which is considerably more compact for metadata with many small
+// dictionaries.
+#if defined(OTIO_FLAT_ANY_DICTIONARY)
+using AnyDictionaryStorage = FlatStringMap<std::any>;
+#else
+using AnyDictionaryStorage = std::map<std::string, std::any>;
+#endif
+
 /**
  * An AnyDictionary has exactly the same API as
  *    std::map<std::string, std::any>
  *
  * except that it records a "time-stamp" that bumps monotonically every time an
  * operation that would invalidate iterators is performed.
- * (This happens for operator=, clear, erase, insert, swap).  The stamp also
+ * (This happens for operator=, clear, erase, swap and, with the flat storage,
+ * for any insertion of a new key).  The stamp also
  * lets external observers know when the map has been destroyed (which includes
  * the case of the map being relocated in memory).
  *
@@ -26,23 +43,34 @@ namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
  * and take steps to safe-guard themselves from causing a crash.  (Yes,
  * I'm talking to you, Python...)
  */
-class AnyDictionary : private std::map<std::string, std::any>
+class AnyDictionary : private AnyDictionaryStorage
 {
+    using storage = AnyDictionaryStorage;
+
 public:
-    using map::map;
+    using storage::storage;
 
     AnyDictionary()
-        : map{}
+        : storage{}
         , _mutation_stamp{}
     {}
 
     // to be safe, avoid brace-initialization so as to not trigger
     // list initialization behavior in older compilers:
     AnyDictionary(const AnyDictionary& other)
-        : map(other)
+        : storage(other)
         , _mutation_stamp{}
     {}
 
+    // moving empties other, so its observers are told, as with erase
+    AnyDictionary(AnyDictionary&& other) noexcept(
+        std::is_nothrow_move_constructible<storage>::value)
+        : storage(std::move(other))
+        , _mutation_stamp{}
+    {
+        other.mutate();
+    }
+
     ~AnyDictionary()
     {
         if (_mutation_stamp)
@@ -55,7 +83,7 @@ public:
     AnyDictionary& operator=(const AnyDictionary& other)
     {
         mutate();
-        map::operator=(other);
+        storage::operator=(other);
         return *this;
     }
 
@@ -63,63 +91,130 @@ public:
     {
         mutate();
         other.mutate();
-        map::operator=(other);
+        storage::operator=(std::move(other));
         return *this;
     }
 
     AnyDictionary& operator=(std::initializer_list<value_type> ilist)
     {
         mutate();
-        map::operator=(ilist);
+        storage::operator=(ilist);
         return *this;
     }
 
-    using map::get_allocator;
+    using storage::get_allocator;
 
-    using map::at;
-    using map::operator[];
+    using storage::at;
 
-    using map::begin;
-    using map::cbegin;
-    using map::cend;
-    using map::crbegin;
-    using map::crend;
-    using map::end;
-    using map::rbegin;
-    using map::rend;
+    using storage::begin;
+    using storage::cbegin;
+    using storage::cend;
+    using storage::crbegin;
+    using storage::crend;
+    using storage::end;
+    using storage::rbegin;
+    using storage::rend;
 
     void clear() noexcept
     {
         mutate();
-        map::clear();
+        storage::clear();
+    }
+#if defined(OTIO_FLAT_ANY_DICTIONARY)
+    // Inserting into the flat storage moves existing entries, so any
+    // insertion that adds a key must bump the stamp.
+    mapped_type& operator[](key_type const& key)
+    {
+        _InsertionGuard guard(this);
+        return storage::operator[](key);
+    }
+
+    mapped_type& operator[](key_type&& key)
+    {
+        _InsertionGuard guard(this);
+        return storage::operator[](std::move(key));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        _InsertionGuard guard(this);
+        return storage::emplace(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        _InsertionGuard guard(this);
+        return storage::emplace_hint(hint, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(value_type const& value)
+    {
+        _InsertionGuard guard(this);
+        return storage::insert(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        _InsertionGuard guard(this);
+        return storage::insert(std::move(value));
+    }
+
+    iterator insert(const_iterator hint, value_type const& value)
+    {
+        _InsertionGuard guard(this);
+        return storage::insert(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        _InsertionGuard guard(this);
+        return storage::insert(hint, std::move(value));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        _InsertionGuard guard(this);
+        storage::insert(first, last);
     }
-    using map::emplace;
-    using map::emplace_hint;
-    using map::insert;
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        _InsertionGuard guard(this);
+        storage::insert(ilist);
+    }
+#else
+    using storage::operator[];
+    using storage::emplace;
+    using storage::emplace_hint;
+    using storage::insert;
+#endif
 
     iterator erase(const_iterator pos)
     {
         mutate();
-        return map::erase(pos);
+        return storage::erase(pos);
     }
 
     iterator erase(const_iterator first, const_iterator last)
     {
         mutate();
-        return map::erase(first, last);
+        return storage::erase(first, last);
     }
 
     size_type erase(const key_type& key)
     {
         mutate();
-        return map::erase(key);
+        return storage::erase(key);
     }
 
     void swap(AnyDictionary& other)
     {
         mutate();
         other.mutate();
-        map::swap(other);
+        storage::swap(other);
     }
 
     /// @TODO: remove all of these @{
@@ -181,34 +276,34 @@ public:
         }
     }
 
-    using map::empty;
-    using map::max_size;
-    using map::size;
-
-    using map::count;
-    using map::equal_range;
-    using map::find;
-    using map::lower_bound;
-    using map::upper_bound;
-
-    using map::key_comp;
-    using map::value_comp;
-
-    using map::allocator_type;
-    using map::const_iterator;
-    using map::const_pointer;
-    using map::const_reference;
-    using map::const_reverse_iterator;
-    using map::difference_type;
-    using map::iterator;
-    using map::key_compare;
-    using map::key_type;
-    using map::mapped_type;
-    using map::pointer;
-    using map::reference;
-    using map::reverse_iterator;
-    using map::size_type;
-    using map::value_type;
+    using storage::empty;
+    using storage::max_size;
+    using storage::size;
+
+    using storage::count;
+    using storage::equal_range;
+    using storage::find;
+    using storage::lower_bound;
+    using storage::upper_bound;
+
+    using storage::key_comp;
+    using storage::value_comp;
+
+    using storage::allocator_type;
+    using storage::const_iterator;
+    using storage::const_pointer;
+    using storage::const_reference;
+    using storage::const_reverse_iterator;
+    using storage::difference_type;
+    using storage::iterator;
+    using storage::key_compare;
+    using storage::key_type;
+    using storage::mapped_type;
+    using storage::pointer;
+    using storage::reference;
+    using storage::reverse_iterator;
+    using storage::size_type;
+    using storage::value_type;
 
     struct MutationStamp
     {
@@ -270,6 +365,27 @@ private:
             _mutation_stamp->stamp++;
         }
     }
+
+#if defined(OTIO_FLAT_ANY_DICTIONARY)
+    struct _InsertionGuard
+    {
+        _InsertionGuard(AnyDictionary* d) noexcept
+            : dictionary{ d }
+            , size{ d->size() }
+        {}
+
+        ~_InsertionGuard()
+        {
+            if (dictionary->size() != size)
+            {
+                dictionary->mutate();
+            }
+        }
+
+        AnyDictionary* dictionary;
+        size_type      size;
+    };
+#endif
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/anyKind.h"
+#include "opentimelineio/anyDictionary.h"
+#include "opentimelineio/anyVector.h"
+#include "opentimelineio/serializableObject.h"
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+struct KindEntry
+{
+    std::type_info const* type;
+    AnyKind               kind;
+};
+
+// Roughly in order of how often each type turns up in a timeline.
+KindEntry const kind_table[] = {
+    { &typeid(std::string), AnyKind::string },
+    { &typeid(double), AnyKind::double_ },
+    { &typeid(int64_t), AnyKind::int64 },
+    { &typeid(bool), AnyKind::boolean },
+    { &typeid(AnyDictionary), AnyKind::dictionary },
+    { &typeid(AnyVector), AnyKind::vector },
+    { &typeid(SerializableObject::Retainer<>), AnyKind::retainer },
+    { &typeid(RationalTime), AnyKind::rational_time },
+    { &typeid(TimeRange), AnyKind::time_range },
+    { &typeid(void), AnyKind::null },
+    { &typeid(TimeTransform), AnyKind::time_transform },
+    { &typeid(IMATH_NAMESPACE::V2d), AnyKind::v2d },
+    { &typeid(IMATH_NAMESPACE::Box2d), AnyKind::box2d },
+    { &typeid(char const*), AnyKind::c_string },
+    { &typeid(SerializableObject::ReferenceId), AnyKind::reference_id },
+};
+
+} // namespace
+
+AnyKind
+any_kind(std::type_info const& type) noexcept
+{
+    /*
+     * Comparing type_info addresses is a handful of pointer compares, but
+     * the same type can have more than one type_info when anys cross a
+     * shared-library boundary.  Only when the fast scan fails do we fall
+     * back on type_info::operator==, which may compare names.
+     */
+    for (auto const& e: kind_table)
+    {
+        if (e.type == &type)
+        {
+            return e.kind;
+        }
+    }
+
+    for (auto const& e: kind_table)
+    {
+        if (*e.type == type)
+        {
+            return e.kind;
+        }
+    }
+
+    return AnyKind::unknown;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
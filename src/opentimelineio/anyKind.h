@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/version.h"
+
+#include <any>
+#include <cstdint>
+#include <typeinfo>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * The closed set of value types that OTIO knows how to serialize, compare
+ * and convert when they are held in a std::any (in metadata, for instance).
+ *
+ * Code that needs to act on the type of an any should classify it once with
+ * any_kind() and switch on the result, rather than probing it with a chain
+ * of any_cast<>s or looking its typeid up in a table.
+ */
+enum class AnyKind : uint8_t
+{
+    unknown = 0,
+    null,
+    boolean,
+    int64,
+    double_,
+    string,
+    c_string,
+    rational_time,
+    time_range,
+    time_transform,
+    v2d,
+    box2d,
+    retainer,
+    reference_id,
+    dictionary,
+    vector
+};
+
+/// The kind of type, or AnyKind::unknown if it is not an OTIO value type.
+///
+/// Types are matched by type_info identity first, and only then by name,
+/// so anys packaged by a different shared library (see safely_typed_any.h)
+/// are still classified correctly.
+AnyKind any_kind(std::type_info const& type) noexcept;
+
+/// The kind of the value held by value; an empty any is AnyKind::null.
+inline AnyKind
+any_kind(std::any const& value) noexcept
+{
+    return any_kind(value.type());
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
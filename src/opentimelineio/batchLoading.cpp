@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/batchLoading.h"
+#include "parallelFor.h"
+
+#include <cerrno>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+std::vector<LoadResult>
+load_many(std::vector<std::string> const& paths, int thread_count)
+{
+    std::vector<LoadResult> results(paths.size());
+    parallel_for(
+        paths.size(),
+        parallel_thread_count(thread_count, paths.size()),
+        [&](size_t i) {
+            LoadResult& result = results[i];
+            result.path        = paths[i];
+
+            // errno belongs to the thread that reads the file, so it is
+            // kept with the result rather than left for the caller.
+            errno         = 0;
+            result.object = SerializableObject::from_json_file(
+                paths[i],
+                &result.error_status);
+            if (result.error_status.outcome == ErrorStatus::FILE_OPEN_FAILED)
+            {
+                result.error_number = errno;
+            }
+        });
+    return results;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
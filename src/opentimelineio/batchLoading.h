@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/serializableObject.h"
+#include "opentimelineio/version.h"
+
+#include <string>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/// The outcome of reading one file with load_many().
+struct LoadResult
+{
+    std::string path;
+
+    /// The object read, or null if it could not be read.
+    SerializableObject::Retainer<> object;
+
+    /// Why the file could not be read, as from_json_file() would report it.
+    ErrorStatus error_status;
+
+    /// The errno from opening the file, if the error is FILE_OPEN_FAILED,
+    /// or else zero.  It is taken on the thread that opened the file.
+    int error_number = 0;
+};
+
+/**
+ * Read many .otio files at once, sharing them out between a bounded number
+ * of threads.
+ *
+ * Each file is read by SerializableObject::from_json_file() into its own
+ * object graph, and a file that cannot be read does not stop the others
+ * from being read.  The results are in the order of the paths.
+ *
+ * A thread_count of zero means one thread per hardware thread.  Files are
+ * handed out one at a time, so a few large files do not hold up the rest.
+ */
+std::vector<LoadResult>
+load_many(std::vector<std::string> const& paths, int thread_count = 0);
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
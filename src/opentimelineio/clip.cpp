@@ -106,6 +106,7 @@ Clip::set_media_references(
     }
 
     _active_media_reference_key = new_active_key;
+    _timing_changed();
 }
 
 std::string
@@ -128,6 +129,7 @@ Clip::set_active_media_reference_key(
         return;
     }
     _active_media_reference_key = new_active_key;
+    _timing_changed();
 }
 
 void
@@ -135,6 +137,7 @@ Clip::set_media_reference(MediaReference* media_reference)
 {
     _media_references[_active_media_reference_key] =
         media_reference ? media_reference : new MissingReference;
+    _timing_changed();
 }
 
 bool
@@ -9,6 +9,7 @@ namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 Composable::Composable(std::string const& name, AnyDictionary const& metadata)
     : Parent(name, metadata)
     , _parent(nullptr)
+    , _timing_generation(0)
 {}
 
 Composable::~Composable()
@@ -49,6 +50,17 @@ Composable::_highest_ancestor() noexcept
     return c;
 }
 
+void
+Composable::_timing_changed() noexcept
+{
+    // A change anywhere in a hierarchy can shift the items that follow it,
+    // so it is recorded all the way up to the root.
+    for (Composable* c = this; c; c = c->_parent)
+    {
+        ++c->_timing_generation;
+    }
+}
+
 bool
 Composable::read_from(Reader& reader)
 {
@@ -46,6 +46,11 @@ protected:
         return const_cast<Composable*>(this)->_highest_ancestor();
     }
 
+    /// Record a change that may move this object, or others in the same
+    /// hierarchy, in time, so that cached TimeMappings and
+    /// MediaTimeEvaluators recompile.
+    void _timing_changed() noexcept;
+
     virtual ~Composable();
 
     bool read_from(Reader&) override;
@@ -53,7 +58,10 @@ protected:
 
 private:
     Composition* _parent;
+    uint64_t     _timing_generation;
     friend class Composition;
+    friend class MediaTimeEvaluator;
+    friend class TimeMapping;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -41,6 +41,7 @@ Composition::clear_children()
 
     _children.clear();
     _child_set.clear();
+    _timing_changed();
 }
 
 bool
@@ -67,6 +68,7 @@ Composition::set_children(
 
     _children  = decltype(_children)(children.begin(), children.end());
     _child_set = std::set<Composable*>(children.begin(), children.end());
+    _timing_changed();
     return true;
 }
 
@@ -98,6 +100,7 @@ Composition::insert_child(
     }
 
     _child_set.insert(child);
+    _timing_changed();
     return true;
 }
 
@@ -130,6 +133,7 @@ Composition::set_child(int index, Composable* child, ErrorStatus* error_status)
         child->_set_parent(this);
         _children[index] = child;
         _child_set.insert(child);
+        _timing_changed();
     }
     return true;
 }
@@ -162,6 +166,7 @@ Composition::remove_child(int index, ErrorStatus* error_status)
         _children.erase(_children.begin() + index);
     }
 
+    _timing_changed();
     return true;
 }
 
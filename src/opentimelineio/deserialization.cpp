@@ -4,6 +4,7 @@
 #include "opentime/rationalTime.h"
 #include "opentime/timeRange.h"
 #include "opentime/timeTransform.h"
+#include "opentimelineio/deserialization.h"
 #include "opentimelineio/serializableObject.h"
 #include "opentimelineio/serializableObjectWithMetadata.h"
 #include "stringUtils.h"
@@ -12,7 +13,12 @@
 #include <rapidjson/cursorstreamwrapper.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/filereadstream.h>
+#include <rapidjson/memorystream.h>
 #include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <memory>
 
 #if defined(_WINDOWS)
 #    ifndef WIN32_LEAN_AND_MEAN
@@ -30,8 +36,13 @@ class JSONDecoder : public OTIO_rapidjson::
                         BaseReaderHandler<OTIO_rapidjson::UTF8<>, JSONDecoder>
 {
 public:
-    JSONDecoder(std::function<size_t()> line_number_function)
+    JSONDecoder(
+        std::function<size_t()> line_number_function,
+        bool                    lazy_metadata = false)
         : _line_number_function{ line_number_function }
+#ifndef OTIO_INSTANCING_SUPPORT
+        , _lazy_metadata(lazy_metadata)
+#endif
     {
         using namespace std::placeholders;
         _error_function = std::bind(&JSONDecoder::_error, this, _1);
@@ -56,25 +67,39 @@ public:
         }
     }
 
-    bool Null() { return store(std::any()); }
-    bool Bool(bool b) { return store(std::any(b)); }
+    bool Null() { return _capture ? _capture->Null() : store(std::any()); }
+    bool Bool(bool b)
+    {
+        return _capture ? _capture->Bool(b) : store(std::any(b));
+    }
 
     // coerce all integer types to int64_t...
-    bool Int(int i) { return store(std::any(static_cast<int64_t>(i))); }
-    bool Int64(int64_t i) { return store(std::any(static_cast<int64_t>(i))); }
-    bool Uint(unsigned u) { return store(std::any(static_cast<int64_t>(u))); }
+    bool Int(int i) { return Int64(i); }
+    bool Int64(int64_t i)
+    {
+        return _capture ? _capture->Int64(i)
+                        : store(std::any(static_cast<int64_t>(i)));
+    }
+    bool Uint(unsigned u) { return Int64(u); }
     bool Uint64(uint64_t u)
     {
         /// prevent an overflow
-        return store(std::any(static_cast<int64_t>(u & 0x7FFFFFFFFFFFFFFF)));
+        return Int64(static_cast<int64_t>(u & 0x7FFFFFFFFFFFFFFF));
     }
 
     // ...and all floating point types to double
-    bool Double(double d) { return store(std::any(d)); }
+    bool Double(double d)
+    {
+        return _capture ? _capture->Double(d) : store(std::any(d));
+    }
 
     bool
     String(const char* str, OTIO_rapidjson::SizeType length, bool /* copy */)
     {
+        if (_capture)
+        {
+            return _capture->String(str, length);
+        }
         return store(std::any(std::string(str, length)));
     }
 
@@ -85,6 +110,12 @@ public:
             return false;
         }
 
+        if (_capture)
+        {
+            _capture_has_schema |= std::string(str, length) == "OTIO_SCHEMA";
+            return _capture->Key(str, length);
+        }
+
         if (_stack.empty() || !_stack.back().is_dict)
         {
             _internal_error(
@@ -92,7 +123,13 @@ public:
             return false;
         }
 
-        _stack.back().cur_key = std::string(str, length);
+        auto& top   = _stack.back();
+        top.cur_key = std::string(str, length);
+
+        // The metadata of an object is the value of its "metadata" key; the
+        // object's OTIO_SCHEMA, which OTIO writes first, has been read.
+        _metadata_next = _lazy_metadata && top.cur_key == "metadata"
+                         && top.dict.find("OTIO_SCHEMA") != top.dict.end();
         return true;
     }
 
@@ -103,6 +140,13 @@ public:
             return false;
         }
 
+        if (_capture)
+        {
+            ++_capture_depth;
+            return _capture->StartArray();
+        }
+
+        _metadata_next = false;
         _stack.emplace_back(_DictOrArray{ false /* is_dict*/ });
         return true;
     }
@@ -114,6 +158,22 @@ public:
             return false;
         }
 
+        if (_capture)
+        {
+            ++_capture_depth;
+            return _capture->StartObject();
+        }
+
+        if (_metadata_next)
+        {
+            _metadata_next = false;
+            _capture_buffer.Clear();
+            _capture.reset(new _CaptureWriter(_capture_buffer));
+            _capture_depth      = 1;
+            _capture_has_schema = false;
+            return _capture->StartObject();
+        }
+
         _stack.emplace_back(_DictOrArray{ true /* is_dict*/ });
         return true;
     }
@@ -125,6 +185,12 @@ public:
             return false;
         }
 
+        if (_capture)
+        {
+            --_capture_depth;
+            return _capture->EndArray();
+        }
+
         if (_stack.empty())
         {
             _internal_error(
@@ -157,6 +223,12 @@ public:
             return false;
         }
 
+        if (_capture)
+        {
+            _capture->EndObject();
+            return --_capture_depth > 0 || _end_capture();
+        }
+
         if (_stack.empty())
         {
             _internal_error(
@@ -194,6 +266,8 @@ public:
             return false;
         }
 
+        _metadata_next = false;
+
         if (_stack.empty())
         {
             _root.swap(a);
@@ -203,11 +277,11 @@ public:
             auto& top = _stack.back();
             if (top.is_dict)
             {
-                top.dict.emplace(_stack.back().cur_key, a);
+                top.dict.emplace(_stack.back().cur_key, std::move(a));
             }
             else
             {
-                top.array.emplace_back(a);
+                top.array.emplace_back(std::move(a));
             }
         }
         return true;
@@ -253,11 +327,51 @@ public:
         std::string   cur_key;
     };
 
+    // Store captured metadata as JSON, or parsed if it holds objects,
+    // which have to be read as the rest of the input is.
+    bool _end_capture()
+    {
+        _capture.reset();
+        if (!_capture_has_schema)
+        {
+            return store(std::any(SerializableObject::RawJSON{ std::string(
+                _capture_buffer.GetString(),
+                _capture_buffer.GetSize()) }));
+        }
+
+        std::any value;
+        if (!deserialize_json_from_buffer(
+                _capture_buffer.GetString(),
+                _capture_buffer.GetSize(),
+                &value,
+                &_error_status))
+        {
+            return false;
+        }
+        return store(std::move(value));
+    }
+
     std::vector<_DictOrArray>               _stack;
     std::function<void(ErrorStatus const&)> _error_function;
     std::function<size_t()>                 _line_number_function;
 
     SerializableObject::Reader::_Resolver _resolver;
+
+    // With lazy metadata, the metadata of each object is captured as JSON
+    // instead of being decoded.
+    using _CaptureWriter = OTIO_rapidjson::Writer<
+        OTIO_rapidjson::StringBuffer,
+        OTIO_rapidjson::UTF8<>,
+        OTIO_rapidjson::UTF8<>,
+        OTIO_rapidjson::CrtAllocator,
+        OTIO_rapidjson::kWriteNanAndInfFlag>;
+
+    bool                            _lazy_metadata = false;
+    bool                            _metadata_next = false;
+    OTIO_rapidjson::StringBuffer    _capture_buffer;
+    std::unique_ptr<_CaptureWriter> _capture;
+    size_t                          _capture_depth      = 0;
+    bool                            _capture_has_schema = false;
 };
 
 SerializableObject::Reader::Reader(
@@ -735,6 +849,11 @@ SerializableObject::Reader::read(std::string const& key, TimeTransform* value)
 bool
 SerializableObject::Reader::read(std::string const& key, AnyDictionary* value)
 {
+    auto e = _dict.find(key);
+    if (e != _dict.end())
+    {
+        _parse_raw_json(e->second);
+    }
     return _fetch(key, value);
 }
 
@@ -843,22 +962,42 @@ SerializableObject::Reader::read(std::string const& key, std::any* value)
     }
     else
     {
+        _parse_raw_json(e->second);
         value->swap(e->second);
         _dict.erase(e);
         return true;
     }
 }
 
+void
+SerializableObject::Reader::_parse_raw_json(std::any& value)
+{
+    if (value.type() != typeid(RawJSON))
+    {
+        return;
+    }
+
+    // The JSON was written by the decoder, so it parses.
+    std::any parsed;
+    deserialize_json_from_string(
+        std::any_cast<RawJSON const&>(value).json,
+        &parsed);
+    value.swap(parsed);
+}
+
 bool
 deserialize_json_from_string(
     std::string const& input,
     std::any*          destination,
-    ErrorStatus*       error_status)
+    ErrorStatus*       error_status,
+    bool               lazy_metadata)
 {
     OTIO_rapidjson::Reader                            reader;
     OTIO_rapidjson::StringStream                      ss(input.c_str());
     OTIO_rapidjson::CursorStreamWrapper<decltype(ss)> csw(ss);
-    JSONDecoder handler(std::bind(&decltype(csw)::GetLine, &csw));
+    JSONDecoder handler(
+        std::bind(&decltype(csw)::GetLine, &csw),
+        lazy_metadata);
 
     bool status =
         reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(csw, handler);
@@ -890,11 +1029,57 @@ deserialize_json_from_string(
     return true;
 }
 
+bool
+deserialize_json_from_buffer(
+    char const*  data,
+    size_t       size,
+    std::any*    destination,
+    ErrorStatus* error_status,
+    bool         lazy_metadata)
+{
+    OTIO_rapidjson::Reader                            reader;
+    OTIO_rapidjson::MemoryStream                      ms(data, size);
+    OTIO_rapidjson::CursorStreamWrapper<decltype(ms)> csw(ms);
+    JSONDecoder handler(
+        std::bind(&decltype(csw)::GetLine, &csw),
+        lazy_metadata);
+
+    bool status =
+        reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(csw, handler);
+    handler.finalize();
+
+    if (handler.has_errored(error_status))
+    {
+        return false;
+    }
+
+    if (!status)
+    {
+        if (error_status)
+        {
+            auto msg      = GetParseError_En(reader.GetParseErrorCode());
+            *error_status = ErrorStatus(
+                ErrorStatus::JSON_PARSE_ERROR,
+                string_printf(
+                    "JSON parse error on input buffer: %s "
+                    "(line %d, column %d)",
+                    msg,
+                    csw.GetLine(),
+                    csw.GetColumn()));
+        }
+        return false;
+    }
+
+    destination->swap(handler._root);
+    return true;
+}
+
 bool
 deserialize_json_from_file(
     std::string const& file_name,
     std::any*          destination,
-    ErrorStatus*       error_status)
+    ErrorStatus*       error_status,
+    bool               lazy_metadata)
 {
 
     FILE* fp = nullptr;
@@ -925,7 +1110,9 @@ deserialize_json_from_file(
     char                           readBuffer[65536];
     OTIO_rapidjson::FileReadStream fs(fp, readBuffer, sizeof(readBuffer));
     OTIO_rapidjson::CursorStreamWrapper<decltype(fs)> csw(fs);
-    JSONDecoder handler(std::bind(&decltype(csw)::GetLine, &csw));
+    JSONDecoder handler(
+        std::bind(&decltype(csw)::GetLine, &csw),
+        lazy_metadata);
 
     bool status =
         reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(csw, handler);
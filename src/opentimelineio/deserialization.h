@@ -11,14 +11,35 @@
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+/**
+ * Parse JSON into a value.
+ *
+ * With lazy_metadata, the metadata of each object is kept as compact JSON
+ * rather than parsed into dictionaries, and is parsed the first time it is
+ * used.  Metadata that is never used is written back out without being
+ * parsed into values, so large metadata that is only carried through costs
+ * little to read and write.  Metadata that holds objects is always parsed,
+ * and builds with OTIO_INSTANCING_SUPPORT ignore lazy_metadata.
+ */
 bool deserialize_json_from_string(
     std::string const& input,
     std::any*          destination,
-    ErrorStatus*       error_status = nullptr);
+    ErrorStatus*       error_status  = nullptr,
+    bool               lazy_metadata = false);
+
+/// Parse JSON from a caller-owned buffer of the given size. The buffer
+/// need not be NUL-terminated, so memory-mapped data can be parsed in place.
+bool deserialize_json_from_buffer(
+    char const*  data,
+    size_t       size,
+    std::any*    destination,
+    ErrorStatus* error_status  = nullptr,
+    bool         lazy_metadata = false);
 
 bool deserialize_json_from_file(
     std::string const& file_name,
     std::any*          destination,
-    ErrorStatus*       error_status = nullptr);
+    ErrorStatus*       error_status  = nullptr,
+    bool               lazy_metadata = false);
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -42,7 +42,8 @@ struct ErrorStatus
         CANNOT_COMPUTE_BOUNDS,
         MEDIA_REFERENCES_DO_NOT_CONTAIN_ACTIVE_KEY,
         MEDIA_REFERENCES_CONTAIN_EMPTY_KEY,
-        NOT_A_GAP
+        NOT_A_GAP,
+        MALFORMED_BUNDLE
     };
 
     ErrorStatus()
@@ -0,0 +1,1286 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/fileBundle.h"
+#include "opentimelineio/deserialization.h"
+#include "stringUtils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+
+#if defined(_WINDOWS)
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif // WIN32_LEAN_AND_MEAN
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif // NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// A read-only memory mapping of an entire file.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    ~MappedFile() { unmap(); }
+
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    bool map(fs::path const& path)
+    {
+        unmap();
+#if defined(_WINDOWS)
+        HANDLE file = CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            NULL,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        if (size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            _data = "";
+            return true;
+        }
+
+        HANDLE mapping =
+            CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (!mapping)
+        {
+            return false;
+        }
+
+        // The view keeps the mapping alive, so the handle can go now.
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view)
+        {
+            return false;
+        }
+
+        _data   = static_cast<char const*>(view);
+        _size   = static_cast<size_t>(size.QuadPart);
+        _mapped = true;
+#else  // _WINDOWS
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            ::close(fd);
+            return false;
+        }
+
+        if (st.st_size == 0)
+        {
+            ::close(fd);
+            _data = "";
+            return true;
+        }
+
+        void* view = mmap(
+            nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE,
+            fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        _data   = static_cast<char const*>(view);
+        _size   = static_cast<size_t>(st.st_size);
+        _mapped = true;
+#endif // _WINDOWS
+        return true;
+    }
+
+    void unmap()
+    {
+        if (_mapped)
+        {
+#if defined(_WINDOWS)
+            UnmapViewOfFile(_data);
+#else
+            munmap(const_cast<char*>(_data), _size);
+#endif
+        }
+        _data   = nullptr;
+        _size   = 0;
+        _mapped = false;
+    }
+
+    char const* data() const noexcept { return _data; }
+
+    size_t size() const noexcept { return _size; }
+
+private:
+    char const* _data   = nullptr;
+    size_t      _size   = 0;
+    bool        _mapped = false;
+};
+
+uint32_t
+crc32(char const* data, size_t size)
+{
+    static uint32_t const* table = [] {
+        static uint32_t t[256];
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+            {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i)
+    {
+        crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF]
+              ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// A small decoder for raw deflate streams (RFC 1951), which is all that a
+// bundle written by the otioz adapter requires.  Output is written into a
+// caller-provided buffer whose size is known from the zip directory, so no
+// reallocation happens while decoding.
+class Inflater
+{
+public:
+    Inflater(
+        unsigned char const* in,
+        size_t               in_size,
+        char*                out,
+        size_t               out_size)
+        : _in(in)
+        , _in_size(in_size)
+        , _out(out)
+        , _out_size(out_size)
+    {}
+
+    // Returns true if a complete stream was decoded and it filled the
+    // output buffer exactly.
+    bool inflate()
+    {
+        int last = 0;
+        do
+        {
+            int type;
+            if (!_bits(1, &last) || !_bits(2, &type))
+            {
+                return false;
+            }
+
+            bool ok = false;
+            switch (type)
+            {
+                case 0:
+                    ok = _stored();
+                    break;
+                case 1:
+                    ok = _fixed();
+                    break;
+                case 2:
+                    ok = _dynamic();
+                    break;
+                default:
+                    break;
+            }
+            if (!ok)
+            {
+                return false;
+            }
+        } while (!last);
+
+        return _out_pos == _out_size;
+    }
+
+private:
+    static constexpr int max_bits        = 15;
+    static constexpr int max_lit_codes   = 286;
+    static constexpr int max_dist_codes  = 30;
+    static constexpr int fixed_lit_codes = 288;
+
+    struct Huffman
+    {
+        short count[max_bits + 1];
+        short symbol[fixed_lit_codes];
+    };
+
+    bool _bits(int need, int* value)
+    {
+        uint32_t buffer = _bit_buffer;
+        while (_bit_count < need)
+        {
+            if (_in_pos == _in_size)
+            {
+                return false;
+            }
+            buffer |= uint32_t(_in[_in_pos++]) << _bit_count;
+            _bit_count += 8;
+        }
+        _bit_buffer = buffer >> need;
+        _bit_count -= need;
+        *value = int(buffer & ((1u << need) - 1));
+        return true;
+    }
+
+    // Canonical Huffman decode, one bit at a time.  Returns -1 on a
+    // malformed code or truncated input.
+    int _decode(Huffman const& h)
+    {
+        int code  = 0;
+        int first = 0;
+        int index = 0;
+        for (int len = 1; len <= max_bits; ++len)
+        {
+            int bit;
+            if (!_bits(1, &bit))
+            {
+                return -1;
+            }
+            code |= bit;
+            int count = h.count[len];
+            if (code - count < first)
+            {
+                return h.symbol[index + (code - first)];
+            }
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+
+    // Build decoding tables from code lengths.  Incomplete codes are
+    // permitted (a single distance code is legal), over-subscribed ones
+    // are not.
+    static bool _build(Huffman* h, short const* lengths, int n)
+    {
+        std::memset(h->count, 0, sizeof(h->count));
+        for (int symbol = 0; symbol < n; ++symbol)
+        {
+            h->count[lengths[symbol]]++;
+        }
+        if (h->count[0] == n)
+        {
+            return true;
+        }
+
+        int left = 1;
+        for (int len = 1; len <= max_bits; ++len)
+        {
+            left <<= 1;
+            left -= h->count[len];
+            if (left < 0)
+            {
+                return false;
+            }
+        }
+
+        short offsets[max_bits + 1];
+        offsets[1] = 0;
+        for (int len = 1; len < max_bits; ++len)
+        {
+            offsets[len + 1] = offsets[len] + h->count[len];
+        }
+        for (int symbol = 0; symbol < n; ++symbol)
+        {
+            if (lengths[symbol] != 0)
+            {
+                h->symbol[offsets[lengths[symbol]]++] = short(symbol);
+            }
+        }
+        return true;
+    }
+
+    bool _stored()
+    {
+        _bit_buffer = 0;
+        _bit_count  = 0;
+
+        if (_in_size - _in_pos < 4)
+        {
+            return false;
+        }
+        size_t len  = _in[_in_pos] | (_in[_in_pos + 1] << 8);
+        size_t nlen = _in[_in_pos + 2] | (_in[_in_pos + 3] << 8);
+        _in_pos += 4;
+        if (len != (~nlen & 0xFFFF) || _in_size - _in_pos < len
+            || _out_size - _out_pos < len)
+        {
+            return false;
+        }
+
+        std::memcpy(_out + _out_pos, _in + _in_pos, len);
+        _in_pos += len;
+        _out_pos += len;
+        return true;
+    }
+
+    bool _codes(Huffman const& lencode, Huffman const& distcode)
+    {
+        static short const length_base[29] = {
+            3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+            31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+        };
+        static short const length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                                1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                                4, 4, 4, 4, 5, 5, 5, 5, 0 };
+        static short const dist_base[30]    = {
+            1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+            33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+            1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+        };
+        static short const dist_extra[30] = { 0, 0, 0,  0,  1,  1,  2,  2,
+                                              3, 3, 4,  4,  5,  5,  6,  6,
+                                              7, 7, 8,  8,  9,  9,  10, 10,
+                                              11, 11, 12, 12, 13, 13 };
+
+        for (;;)
+        {
+            int symbol = _decode(lencode);
+            if (symbol < 0)
+            {
+                return false;
+            }
+            if (symbol < 256)
+            {
+                if (_out_pos == _out_size)
+                {
+                    return false;
+                }
+                _out[_out_pos++] = char(symbol);
+            }
+            else if (symbol == 256)
+            {
+                return true;
+            }
+            else
+            {
+                symbol -= 257;
+                if (symbol >= 29)
+                {
+                    return false;
+                }
+                int extra;
+                if (!_bits(length_extra[symbol], &extra))
+                {
+                    return false;
+                }
+                size_t len = size_t(length_base[symbol] + extra);
+
+                symbol = _decode(distcode);
+                if (symbol < 0 || symbol >= max_dist_codes)
+                {
+                    return false;
+                }
+                if (!_bits(dist_extra[symbol], &extra))
+                {
+                    return false;
+                }
+                size_t dist = size_t(dist_base[symbol] + extra);
+
+                if (dist > _out_pos || _out_size - _out_pos < len)
+                {
+                    return false;
+                }
+
+                // Copies may overlap their own output, so go byte by byte.
+                char* dst = _out + _out_pos;
+                char* src = dst - dist;
+                for (size_t i = 0; i < len; ++i)
+                {
+                    dst[i] = src[i];
+                }
+                _out_pos += len;
+            }
+        }
+    }
+
+    bool _fixed()
+    {
+        static Huffman const* tables = [] {
+            static Huffman t[2];
+            short          lengths[fixed_lit_codes];
+            int            symbol = 0;
+            for (; symbol < 144; ++symbol)
+                lengths[symbol] = 8;
+            for (; symbol < 256; ++symbol)
+                lengths[symbol] = 9;
+            for (; symbol < 280; ++symbol)
+                lengths[symbol] = 7;
+            for (; symbol < fixed_lit_codes; ++symbol)
+                lengths[symbol] = 8;
+            _build(&t[0], lengths, fixed_lit_codes);
+
+            for (symbol = 0; symbol < max_dist_codes; ++symbol)
+                lengths[symbol] = 5;
+            _build(&t[1], lengths, max_dist_codes);
+            return t;
+        }();
+
+        return _codes(tables[0], tables[1]);
+    }
+
+    bool _dynamic()
+    {
+        static short const order[19] = { 16, 17, 18, 0, 8,  7, 9,  6, 10, 5,
+                                         11, 4,  12, 3, 13, 2, 14, 1, 15 };
+
+        int nlen, ndist, ncode;
+        if (!_bits(5, &nlen) || !_bits(5, &ndist) || !_bits(4, &ncode))
+        {
+            return false;
+        }
+        nlen += 257;
+        ndist += 1;
+        ncode += 4;
+        if (nlen > max_lit_codes || ndist > max_dist_codes)
+        {
+            return false;
+        }
+
+        short lengths[max_lit_codes + max_dist_codes];
+        int   index = 0;
+        for (; index < ncode; ++index)
+        {
+            int len;
+            if (!_bits(3, &len))
+            {
+                return false;
+            }
+            lengths[order[index]] = short(len);
+        }
+        for (; index < 19; ++index)
+        {
+            lengths[order[index]] = 0;
+        }
+
+        Huffman lencode, distcode;
+        if (!_build(&lencode, lengths, 19))
+        {
+            return false;
+        }
+
+        index = 0;
+        while (index < nlen + ndist)
+        {
+            int symbol = _decode(lencode);
+            if (symbol < 0)
+            {
+                return false;
+            }
+            if (symbol < 16)
+            {
+                lengths[index++] = short(symbol);
+                continue;
+            }
+
+            short len = 0;
+            int   repeat;
+            if (symbol == 16)
+            {
+                if (index == 0 || !_bits(2, &repeat))
+                {
+                    return false;
+                }
+                len = lengths[index - 1];
+                repeat += 3;
+            }
+            else if (symbol == 17)
+            {
+                if (!_bits(3, &repeat))
+                {
+                    return false;
+                }
+                repeat += 3;
+            }
+            else
+            {
+                if (!_bits(7, &repeat))
+                {
+                    return false;
+                }
+                repeat += 11;
+            }
+            if (index + repeat > nlen + ndist)
+            {
+                return false;
+            }
+            while (repeat--)
+            {
+                lengths[index++] = len;
+            }
+        }
+
+        // A block without an end-of-block code can never terminate.
+        if (lengths[256] == 0)
+        {
+            return false;
+        }
+
+        return _build(&lencode, lengths, nlen)
+               && _build(&distcode, lengths + nlen, ndist)
+               && _codes(lencode, distcode);
+    }
+
+    unsigned char const* _in;
+    size_t               _in_size;
+    size_t               _in_pos     = 0;
+    uint32_t             _bit_buffer = 0;
+    int                  _bit_count  = 0;
+    char*                _out;
+    size_t               _out_size;
+    size_t               _out_pos = 0;
+};
+
+// Zip structures; see PKWARE's APPNOTE.TXT.  Only what is needed to read a
+// single-disk archive is handled, including the zip64 extensions Python's
+// zipfile emits for large media.
+constexpr uint32_t local_header_signature           = 0x04034b50;
+constexpr uint32_t central_header_signature         = 0x02014b50;
+constexpr uint32_t end_of_directory_signature       = 0x06054b50;
+constexpr uint32_t zip64_end_of_directory_signature = 0x06064b50;
+constexpr uint32_t zip64_locator_signature          = 0x07064b50;
+
+constexpr size_t local_header_size           = 30;
+constexpr size_t central_header_size         = 46;
+constexpr size_t end_of_directory_size       = 22;
+constexpr size_t zip64_end_of_directory_size = 56;
+constexpr size_t zip64_locator_size          = 20;
+
+constexpr uint16_t method_stored   = 0;
+constexpr uint16_t method_deflated = 8;
+
+// Deflate cannot expand its input by more than this.
+constexpr uint64_t max_deflate_ratio = 1032;
+
+inline uint16_t
+read_u16(char const* p)
+{
+    auto b = reinterpret_cast<unsigned char const*>(p);
+    return uint16_t(b[0] | (b[1] << 8));
+}
+
+inline uint32_t
+read_u32(char const* p)
+{
+    auto b = reinterpret_cast<unsigned char const*>(p);
+    return uint32_t(b[0]) | (uint32_t(b[1]) << 8) | (uint32_t(b[2]) << 16)
+           | (uint32_t(b[3]) << 24);
+}
+
+inline uint64_t
+read_u64(char const* p)
+{
+    return uint64_t(read_u32(p)) | (uint64_t(read_u32(p + 4)) << 32);
+}
+
+struct ZipEntry
+{
+    uint16_t flags;
+    uint16_t method;
+    uint32_t crc;
+    uint64_t compressed_size;
+    uint64_t size;
+    uint64_t local_header_offset;
+};
+
+bool
+set_malformed(std::string const& details, ErrorStatus* error_status)
+{
+    if (error_status)
+    {
+        *error_status = ErrorStatus(ErrorStatus::MALFORMED_BUNDLE, details);
+    }
+    return false;
+}
+
+bool
+read_central_directory(
+    char const*                      data,
+    size_t                           size,
+    std::map<std::string, ZipEntry>* entries,
+    ErrorStatus*                     error_status)
+{
+    if (size < end_of_directory_size)
+    {
+        return set_malformed("file is too small to be a zip archive",
+                             error_status);
+    }
+
+    // The end of central directory record is followed by a comment of up to
+    // 64K, so search backwards for its signature.
+    size_t eocd  = size - end_of_directory_size;
+    size_t limit = eocd > 0xFFFF ? eocd - 0xFFFF : 0;
+    for (;;)
+    {
+        if (read_u32(data + eocd) == end_of_directory_signature
+            && eocd + end_of_directory_size + read_u16(data + eocd + 20)
+                   <= size)
+        {
+            break;
+        }
+        if (eocd == limit)
+        {
+            return set_malformed("end of central directory not found",
+                                 error_status);
+        }
+        --eocd;
+    }
+
+    if (read_u16(data + eocd + 4) != 0 || read_u16(data + eocd + 6) != 0)
+    {
+        return set_malformed("multi-disk archives are not supported",
+                             error_status);
+    }
+
+    uint64_t count     = read_u16(data + eocd + 10);
+    uint64_t cd_size   = read_u32(data + eocd + 12);
+    uint64_t cd_offset = read_u32(data + eocd + 16);
+
+    if (count == 0xFFFF || cd_size == 0xFFFFFFFF || cd_offset == 0xFFFFFFFF)
+    {
+        if (eocd < zip64_locator_size
+            || read_u32(data + eocd - zip64_locator_size)
+                   != zip64_locator_signature)
+        {
+            return set_malformed("zip64 locator not found", error_status);
+        }
+        uint64_t record = read_u64(data + eocd - zip64_locator_size + 8);
+        if (size < zip64_end_of_directory_size
+            || record > size - zip64_end_of_directory_size
+            || read_u32(data + record) != zip64_end_of_directory_signature)
+        {
+            return set_malformed("zip64 end of central directory not found",
+                                 error_status);
+        }
+        count     = read_u64(data + record + 32);
+        cd_size   = read_u64(data + record + 40);
+        cd_offset = read_u64(data + record + 48);
+    }
+
+    if (cd_offset > size || cd_size > size - cd_offset)
+    {
+        return set_malformed("central directory is out of bounds",
+                             error_status);
+    }
+
+    char const* p   = data + cd_offset;
+    char const* end = p + cd_size;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        if (size_t(end - p) < central_header_size
+            || read_u32(p) != central_header_signature)
+        {
+            return set_malformed("corrupt central directory entry",
+                                 error_status);
+        }
+
+        ZipEntry entry;
+        entry.flags               = read_u16(p + 8);
+        entry.method              = read_u16(p + 10);
+        entry.crc                 = read_u32(p + 16);
+        entry.compressed_size     = read_u32(p + 20);
+        entry.size                = read_u32(p + 24);
+        entry.local_header_offset = read_u32(p + 42);
+
+        size_t name_length    = read_u16(p + 28);
+        size_t extra_length   = read_u16(p + 30);
+        size_t comment_length = read_u16(p + 32);
+        if (size_t(end - p) < central_header_size + name_length + extra_length
+                                  + comment_length)
+        {
+            return set_malformed("corrupt central directory entry",
+                                 error_status);
+        }
+
+        std::string name(p + central_header_size, name_length);
+
+        // Sizes and offsets that overflow 32 bits live in the zip64 extra
+        // field, in a fixed order, present only when the 32 bit value is
+        // saturated.
+        char const* extra     = p + central_header_size + name_length;
+        char const* extra_end = extra + extra_length;
+        while (extra_end - extra >= 4)
+        {
+            uint16_t id         = read_u16(extra);
+            size_t   field_size = read_u16(extra + 2);
+            extra += 4;
+            if (size_t(extra_end - extra) < field_size)
+            {
+                break;
+            }
+            if (id == 0x0001)
+            {
+                char const* q     = extra;
+                char const* q_end = extra + field_size;
+                for (uint64_t* value:
+                     { &entry.size,
+                       &entry.compressed_size,
+                       &entry.local_header_offset })
+                {
+                    if (*value == 0xFFFFFFFF && q_end - q >= 8)
+                    {
+                        *value = read_u64(q);
+                        q += 8;
+                    }
+                }
+            }
+            extra += field_size;
+        }
+
+        p += central_header_size + name_length + extra_length
+             + comment_length;
+
+        if (!name.empty() && name.back() != '/')
+        {
+            (*entries)[std::move(name)] = entry;
+        }
+    }
+
+    return true;
+}
+
+bool
+is_safe_media_name(std::string const& name)
+{
+    std::string const prefix = std::string(FileBundle::media_dir_name) + "/";
+    if (name.compare(0, prefix.size(), prefix) != 0
+        || name.size() == prefix.size())
+    {
+        return false;
+    }
+
+    // Refuse anything that could escape the bundle directory.
+    for (auto const& part: fs::u8path(name))
+    {
+        if (part == ".." || part.has_root_name() || part.has_root_directory())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+struct FileBundle::Impl
+{
+    std::string path;
+    fs::path    root;
+    bool        directory = false;
+
+    // otioz: the mapped archive and its index, built when opened.
+    MappedFile                      archive;
+    std::map<std::string, ZipEntry> entries;
+
+    // Populated lazily as media are requested.
+    mutable std::mutex                                         mutex;
+    mutable std::map<std::string, std::unique_ptr<MappedFile>> mapped_media;
+    mutable std::map<std::string, std::string>                 inflated_media;
+
+    bool map_file(
+        std::string const& name,
+        MappedFile*        file,
+        ErrorStatus*       error_status) const
+    {
+        fs::path file_path = root / fs::u8path(name);
+        if (!file->map(file_path))
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::FILE_OPEN_FAILED, file_path.u8string());
+            }
+            return false;
+        }
+        return true;
+    }
+
+    // The raw, possibly compressed, bytes of an archive entry.
+    bool raw_entry_data(
+        ZipEntry const& entry,
+        char const**    data,
+        ErrorStatus*    error_status) const
+    {
+        if (entry.flags & 0x1)
+        {
+            return set_malformed("encrypted entries are not supported",
+                                 error_status);
+        }
+
+        size_t size = archive.size();
+        if (entry.local_header_offset > size
+            || size - entry.local_header_offset < local_header_size
+            || read_u32(archive.data() + entry.local_header_offset)
+                   != local_header_signature)
+        {
+            return set_malformed("corrupt local file header", error_status);
+        }
+
+        // The local header's own name and extra fields may differ in length
+        // from the central directory's copy, so skip them as recorded here.
+        char const* header = archive.data() + entry.local_header_offset;
+        uint64_t    offset = entry.local_header_offset + local_header_size
+                          + read_u16(header + 26) + read_u16(header + 28);
+        if (offset > size || size - offset < entry.compressed_size)
+        {
+            return set_malformed("entry data is out of bounds", error_status);
+        }
+
+        *data = archive.data() + offset;
+        return true;
+    }
+
+    // The uncompressed bytes of an archive entry.  Stored entries are
+    // returned in place; deflated ones are decoded into storage.
+    bool entry_data(
+        std::string const& name,
+        ZipEntry const&    entry,
+        bool               verify,
+        std::string_view*  view,
+        std::string*       storage,
+        ErrorStatus*       error_status) const
+    {
+        char const* data = nullptr;
+        if (!raw_entry_data(entry, &data, error_status))
+        {
+            return false;
+        }
+
+        if (entry.method == method_stored)
+        {
+            if (entry.compressed_size != entry.size)
+            {
+                return set_malformed("stored entry size mismatch: " + name,
+                                     error_status);
+            }
+            *view = std::string_view(data, size_t(entry.size));
+        }
+        else if (entry.method == method_deflated)
+        {
+            // The size comes from the archive, so check it before
+            // allocating: a small archive may claim a huge entry.  The
+            // inflater then fails unless it fills the storage exactly.
+            if (entry.size / max_deflate_ratio > entry.compressed_size)
+            {
+                return set_malformed("entry size is impossible: " + name,
+                                     error_status);
+            }
+            storage->resize(size_t(entry.size));
+            Inflater inflater(
+                reinterpret_cast<unsigned char const*>(data),
+                size_t(entry.compressed_size),
+                &(*storage)[0],
+                storage->size());
+            if (!inflater.inflate())
+            {
+                return set_malformed("invalid deflate data: " + name,
+                                     error_status);
+            }
+            *view = std::string_view(*storage);
+        }
+        else
+        {
+            return set_malformed(
+                string_printf(
+                    "unsupported compression method %d: %s",
+                    int(entry.method),
+                    name.c_str()),
+                error_status);
+        }
+
+        if (verify && crc32(view->data(), view->size()) != entry.crc)
+        {
+            return set_malformed("checksum mismatch: " + name, error_status);
+        }
+        return true;
+    }
+
+    bool lookup(
+        std::string const& name,
+        ZipEntry const**   entry,
+        ErrorStatus*       error_status) const
+    {
+        auto e = entries.find(name);
+        if (e == entries.end())
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::KEY_NOT_FOUND,
+                    string_printf(
+                        "'%s' not found in bundle '%s'",
+                        name.c_str(),
+                        path.c_str()));
+            }
+            return false;
+        }
+        *entry = &e->second;
+        return true;
+    }
+};
+
+FileBundle::FileBundle()
+{}
+
+FileBundle::~FileBundle()
+{}
+
+bool
+FileBundle::open(std::string const& path, ErrorStatus* error_status)
+{
+    close();
+
+    auto impl  = std::make_unique<Impl>();
+    impl->path = path;
+    impl->root = fs::u8path(path);
+
+    std::error_code ec;
+    impl->directory = fs::is_directory(impl->root, ec);
+    if (!impl->directory)
+    {
+        if (!impl->archive.map(impl->root))
+        {
+            if (error_status)
+            {
+                *error_status =
+                    ErrorStatus(ErrorStatus::FILE_OPEN_FAILED, path);
+            }
+            return false;
+        }
+        ErrorStatus zip_error;
+        if (!read_central_directory(
+                impl->archive.data(),
+                impl->archive.size(),
+                &impl->entries,
+                &zip_error))
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    zip_error.outcome, path + ": " + zip_error.details);
+            }
+            return false;
+        }
+    }
+
+    _impl = std::move(impl);
+    return true;
+}
+
+void
+FileBundle::close()
+{
+    _impl.reset();
+}
+
+bool
+FileBundle::is_open() const noexcept
+{
+    return bool(_impl);
+}
+
+bool
+FileBundle::is_directory() const noexcept
+{
+    return _impl && _impl->directory;
+}
+
+std::string const&
+FileBundle::path() const noexcept
+{
+    static std::string const empty;
+    return _impl ? _impl->path : empty;
+}
+
+std::string
+FileBundle::version(ErrorStatus* error_status) const
+{
+    if (!_impl)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::FILE_OPEN_FAILED, "bundle is not open");
+        }
+        return std::string();
+    }
+
+    std::string_view view;
+    std::string      storage;
+    MappedFile       file;
+    if (_impl->directory)
+    {
+        if (!_impl->map_file(version_file_name, &file, error_status))
+        {
+            return std::string();
+        }
+        view = std::string_view(file.data(), file.size());
+    }
+    else
+    {
+        ZipEntry const* entry;
+        if (!_impl->lookup(version_file_name, &entry, error_status)
+            || !_impl->entry_data(
+                version_file_name, *entry, true, &view, &storage, error_status))
+        {
+            return std::string();
+        }
+    }
+
+    while (!view.empty() && std::isspace(static_cast<unsigned char>(view.back())))
+    {
+        view.remove_suffix(1);
+    }
+    return std::string(view);
+}
+
+SerializableObject*
+FileBundle::read_content(ErrorStatus* error_status) const
+{
+    if (!_impl)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::FILE_OPEN_FAILED, "bundle is not open");
+        }
+        return nullptr;
+    }
+
+    std::string_view view;
+    std::string      storage;
+    MappedFile       file;
+    if (_impl->directory)
+    {
+        if (!_impl->map_file(content_file_name, &file, error_status))
+        {
+            return nullptr;
+        }
+        view = std::string_view(file.data(), file.size());
+    }
+    else
+    {
+        ZipEntry const* entry;
+        if (!_impl->lookup(content_file_name, &entry, error_status)
+            || !_impl->entry_data(
+                content_file_name, *entry, true, &view, &storage, error_status))
+        {
+            return nullptr;
+        }
+    }
+
+    std::any dest;
+    if (!deserialize_json_from_buffer(
+            view.data(), view.size(), &dest, error_status))
+    {
+        return nullptr;
+    }
+
+    if (dest.type() != typeid(SerializableObject::Retainer<>))
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::TYPE_MISMATCH,
+                string_printf(
+                    "Expected a SerializableObject*, found object of type '%s' instead",
+                    type_name_for_error_message(dest.type()).c_str()));
+        }
+        return nullptr;
+    }
+
+    return std::any_cast<SerializableObject::Retainer<>&>(dest).take_value();
+}
+
+std::vector<FileBundle::MediaEntry>
+FileBundle::media_entries() const
+{
+    std::vector<MediaEntry> result;
+    if (!_impl)
+    {
+        return result;
+    }
+
+    std::string const prefix = std::string(media_dir_name) + "/";
+    if (_impl->directory)
+    {
+        std::error_code ec;
+        fs::path        media_root = _impl->root / media_dir_name;
+        for (fs::recursive_directory_iterator i(media_root, ec), end;
+             !ec && i != end;
+             i.increment(ec))
+        {
+            if (!i->is_regular_file(ec))
+            {
+                continue;
+            }
+            std::string name =
+                prefix
+                + i->path().lexically_relative(media_root).generic_u8string();
+            result.push_back(
+                MediaEntry{ std::move(name), uint64_t(i->file_size(ec)), false });
+        }
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](MediaEntry const& a, MediaEntry const& b) {
+                return a.name < b.name;
+            });
+    }
+    else
+    {
+        for (auto e = _impl->entries.lower_bound(prefix);
+             e != _impl->entries.end()
+             && e->first.compare(0, prefix.size(), prefix) == 0;
+             ++e)
+        {
+            result.push_back(MediaEntry{ e->first,
+                                         e->second.size,
+                                         e->second.method != method_stored });
+        }
+    }
+    return result;
+}
+
+bool
+FileBundle::has_media(std::string const& name) const
+{
+    if (!_impl || !is_safe_media_name(name))
+    {
+        return false;
+    }
+
+    if (_impl->directory)
+    {
+        std::error_code ec;
+        return fs::is_regular_file(_impl->root / fs::u8path(name), ec);
+    }
+    return _impl->entries.count(name) != 0;
+}
+
+std::string_view
+FileBundle::media_data(std::string const& name, ErrorStatus* error_status)
+    const
+{
+    if (!_impl)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::FILE_OPEN_FAILED, "bundle is not open");
+        }
+        return std::string_view();
+    }
+
+    if (!is_safe_media_name(name))
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::KEY_NOT_FOUND,
+                string_printf(
+                    "'%s' is not a media entry name", name.c_str()));
+        }
+        return std::string_view();
+    }
+
+    if (_impl->directory)
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+
+        auto& file = _impl->mapped_media[name];
+        if (!file)
+        {
+            auto mapped = std::make_unique<MappedFile>();
+            if (!_impl->map_file(name, mapped.get(), error_status))
+            {
+                _impl->mapped_media.erase(name);
+                return std::string_view();
+            }
+            file = std::move(mapped);
+        }
+        return std::string_view(file->data(), file->size());
+    }
+
+    ZipEntry const* entry;
+    if (!_impl->lookup(name, &entry, error_status))
+    {
+        return std::string_view();
+    }
+
+    // Stored media are handed out directly from the mapping and are not
+    // checksummed, since that would mean touching every page of what may
+    // be a very large file.
+    if (entry->method == method_stored)
+    {
+        std::string_view view;
+        _impl->entry_data(name, *entry, false, &view, nullptr, error_status);
+        return view;
+    }
+
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+
+    auto inflated = _impl->inflated_media.find(name);
+    if (inflated != _impl->inflated_media.end())
+    {
+        return std::string_view(inflated->second);
+    }
+
+    std::string_view view;
+    std::string      storage;
+    if (!_impl->entry_data(name, *entry, true, &view, &storage, error_status))
+    {
+        return std::string_view();
+    }
+    return std::string_view(
+        _impl->inflated_media.emplace(name, std::move(storage)).first->second);
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
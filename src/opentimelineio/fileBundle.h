@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/serializableObject.h"
+#include "opentimelineio/version.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * Read-only access to a file bundle, as written by the "otioz" (zip
+ * archive) and "otiod" (directory) adapters.
+ *
+ * An otioz bundle is memory-mapped when it is opened and its central
+ * directory is indexed; nothing else is read until it is asked for.
+ * "content.otio" is parsed directly from the mapping when it is stored, or
+ * inflated into a temporary buffer when it is deflated.  Media entries are
+ * returned as views: entries stored without compression (which is how the
+ * adapter writes media) point straight into the mapping, so no copy is made.
+ *
+ * An otiod bundle is a plain directory; each media file is mapped the first
+ * time it is requested.
+ *
+ * Views returned by media_data() remain valid until the bundle is closed or
+ * destroyed.  All const member functions are safe to call concurrently.
+ */
+class FileBundle
+{
+public:
+    static constexpr char const* content_file_name = "content.otio";
+    static constexpr char const* version_file_name = "version.txt";
+    static constexpr char const* media_dir_name    = "media";
+
+    struct MediaEntry
+    {
+        std::string name;
+        uint64_t    size;
+        bool        compressed;
+    };
+
+    FileBundle();
+    ~FileBundle();
+
+    FileBundle(FileBundle const&)            = delete;
+    FileBundle& operator=(FileBundle const&) = delete;
+
+    /// Open an .otioz file or an .otiod directory.  Any previously opened
+    /// bundle is closed first.
+    bool open(std::string const& path, ErrorStatus* error_status = nullptr);
+
+    void close();
+
+    bool is_open() const noexcept;
+
+    bool is_directory() const noexcept;
+
+    std::string const& path() const noexcept;
+
+    /// The bundle format version recorded in "version.txt".
+    std::string version(ErrorStatus* error_status = nullptr) const;
+
+    /// Deserialize "content.otio".  As with
+    /// SerializableObject::from_json_file(), the caller takes ownership.
+    SerializableObject* read_content(ErrorStatus* error_status = nullptr) const;
+
+    /// The media entries in the bundle.  Names are relative to the bundle
+    /// root and use forward slashes, e.g. "media/shot_010.mov", matching the
+    /// target URLs written into "content.otio".
+    std::vector<MediaEntry> media_entries() const;
+
+    bool has_media(std::string const& name) const;
+
+    /// The bytes of a media entry.  Returns an empty view and sets
+    /// error_status if the entry does not exist or cannot be read.
+    std::string_view media_data(
+        std::string const& name,
+        ErrorStatus*       error_status = nullptr) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
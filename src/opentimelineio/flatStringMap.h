@@ -0,0 +1,288 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/version.h"
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * A FlatStringMap has the same API as std::map<std::string, T>, but keeps
+ * its entries in a single vector sorted by key.
+ *
+ * Lookups are binary searches over contiguous memory, and short keys live
+ * inside the entries themselves (courtesy of the small string
+ * optimization), so a dictionary of a few dozen keys costs one allocation
+ * rather than one tree node per entry.  The price is that, unlike a
+ * std::map, inserting or erasing an entry invalidates all iterators, and
+ * insertion is linear in the size of the map; both are fine for the
+ * metadata-sized dictionaries this is used for.
+ *
+ * The one other difference is that value_type is std::pair<std::string, T>,
+ * since the entries must be movable; keys must not be modified through an
+ * iterator.
+ */
+template <typename T>
+class FlatStringMap
+{
+public:
+    using key_type               = std::string;
+    using mapped_type            = T;
+    using value_type             = std::pair<std::string, T>;
+    using key_compare            = std::less<std::string>;
+    using allocator_type         = std::allocator<value_type>;
+    using container_type         = std::vector<value_type>;
+    using size_type              = typename container_type::size_type;
+    using difference_type        = typename container_type::difference_type;
+    using reference              = value_type&;
+    using const_reference        = value_type const&;
+    using pointer                = value_type*;
+    using const_pointer          = value_type const*;
+    using iterator               = typename container_type::iterator;
+    using const_iterator         = typename container_type::const_iterator;
+    using reverse_iterator       = typename container_type::reverse_iterator;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    class value_compare
+    {
+    public:
+        bool operator()(value_type const& lhs, value_type const& rhs) const
+        {
+            return lhs.first < rhs.first;
+        }
+    };
+
+    FlatStringMap() = default;
+
+    template <typename InputIt>
+    FlatStringMap(InputIt first, InputIt last)
+    {
+        insert(first, last);
+    }
+
+    FlatStringMap(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist);
+    }
+
+    FlatStringMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+        return *this;
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return _entries.get_allocator();
+    }
+
+    T& at(key_type const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range("FlatStringMap::at");
+        }
+        return it->second;
+    }
+
+    T const& at(key_type const& key) const
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range("FlatStringMap::at");
+        }
+        return it->second;
+    }
+
+    T& operator[](key_type const& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    T& operator[](key_type&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    iterator       begin() noexcept { return _entries.begin(); }
+    const_iterator begin() const noexcept { return _entries.begin(); }
+    const_iterator cbegin() const noexcept { return _entries.cbegin(); }
+    iterator       end() noexcept { return _entries.end(); }
+    const_iterator end() const noexcept { return _entries.end(); }
+    const_iterator cend() const noexcept { return _entries.cend(); }
+
+    reverse_iterator       rbegin() noexcept { return _entries.rbegin(); }
+    const_reverse_iterator rbegin() const noexcept { return _entries.rbegin(); }
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return _entries.crbegin();
+    }
+    reverse_iterator       rend() noexcept { return _entries.rend(); }
+    const_reverse_iterator rend() const noexcept { return _entries.rend(); }
+    const_reverse_iterator crend() const noexcept { return _entries.crend(); }
+
+    bool      empty() const noexcept { return _entries.empty(); }
+    size_type size() const noexcept { return _entries.size(); }
+    size_type max_size() const noexcept { return _entries.max_size(); }
+
+    void clear() noexcept { _entries.clear(); }
+
+    std::pair<iterator, bool> insert(value_type const& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    iterator insert(const_iterator, value_type const& value)
+    {
+        return insert(value).first;
+    }
+
+    iterator insert(const_iterator, value_type&& value)
+    {
+        return insert(std::move(value)).first;
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(value_type(*first));
+        }
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        auto it = lower_bound(key);
+        if (it != end() && it->first == key)
+        {
+            return { it, false };
+        }
+        it = _entries.emplace(
+            it,
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return { it, true };
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator, Args&&... args)
+    {
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    iterator erase(const_iterator pos) { return _entries.erase(pos); }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return _entries.erase(first, last);
+    }
+
+    size_type erase(key_type const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            return 0;
+        }
+        _entries.erase(it);
+        return 1;
+    }
+
+    void swap(FlatStringMap& other) noexcept { _entries.swap(other._entries); }
+
+    size_type count(key_type const& key) const
+    {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    iterator find(key_type const& key)
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it : end();
+    }
+
+    const_iterator find(key_type const& key) const
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it : end();
+    }
+
+    iterator lower_bound(key_type const& key)
+    {
+        return std::lower_bound(begin(), end(), key, _key_less);
+    }
+
+    const_iterator lower_bound(key_type const& key) const
+    {
+        return std::lower_bound(begin(), end(), key, _key_less);
+    }
+
+    iterator upper_bound(key_type const& key)
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it + 1 : it;
+    }
+
+    const_iterator upper_bound(key_type const& key) const
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it + 1 : it;
+    }
+
+    std::pair<iterator, iterator> equal_range(key_type const& key)
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+
+    std::pair<const_iterator, const_iterator>
+    equal_range(key_type const& key) const
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+
+    key_compare   key_comp() const { return key_compare(); }
+    value_compare value_comp() const { return value_compare(); }
+
+private:
+    static bool _key_less(value_type const& entry, key_type const& key)
+    {
+        return entry.first < key;
+    }
+
+    container_type _entries;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/frozenTimeline.h"
+#include "opentimelineio/effect.h"
+#include "opentimelineio/marker.h"
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+// Look up the type record of every object now, so that schema_name() and
+// serialization never have to fill in the cache later, from several
+// threads at once.
+void
+cache_type_records(SerializableObject const* object)
+{
+    if (object)
+    {
+        (void) object->schema_name();
+    }
+}
+
+void
+cache_type_records(Item const* item)
+{
+    cache_type_records(static_cast<SerializableObject const*>(item));
+    for (auto const& effect: item->effects())
+    {
+        cache_type_records(effect.value);
+    }
+    for (auto const& marker: item->markers())
+    {
+        cache_type_records(marker.value);
+    }
+    if (auto clip = dynamic_cast<Clip const*>(item))
+    {
+        for (auto const& reference: clip->media_references())
+        {
+            cache_type_records(reference.second);
+        }
+    }
+}
+
+} // namespace
+
+std::shared_ptr<FrozenTimeline const>
+FrozenTimeline::freeze(Timeline const* timeline, ErrorStatus* error_status)
+{
+    if (!timeline)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::INTERNAL_ERROR,
+                "cannot freeze a null timeline");
+        }
+        return nullptr;
+    }
+
+    SerializableObject::Retainer<> const clone =
+        timeline->clone(error_status);
+    if (is_error(error_status) || !clone)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<FrozenTimeline> frozen(new FrozenTimeline);
+    frozen->_timeline = dynamic_cast<Timeline*>(clone.value);
+    Timeline const* copy = frozen->_timeline;
+
+    frozen->_structure = StructureTable::build(copy, error_status);
+    if (is_error(error_status))
+    {
+        return nullptr;
+    }
+
+    frozen->_schedule = PlaybackScheduleCompiler(copy).schedule(error_status);
+    if (is_error(error_status) || !frozen->_schedule)
+    {
+        return nullptr;
+    }
+
+    cache_type_records(copy);
+    StructureTable const& structure = frozen->_structure;
+    frozen->_rows.reserve(structure.size());
+    for (size_t row = 0; row < structure.size(); ++row)
+    {
+        Composable const* object = structure.object(row);
+        frozen->_rows.emplace(object, int64_t(row));
+        if (auto item = dynamic_cast<Item const*>(object))
+        {
+            cache_type_records(item);
+        }
+        else
+        {
+            cache_type_records(object);
+        }
+        if (structure.kind()[row] == StructureTable::clip)
+        {
+            frozen->_clips.push_back(static_cast<Clip const*>(object));
+        }
+    }
+    return frozen;
+}
+
+int64_t
+FrozenTimeline::row_of(Composable const* object) const noexcept
+{
+    auto const found = _rows.find(object);
+    return found == _rows.end() ? -1 : found->second;
+}
+
+std::optional<TimeRange>
+FrozenTimeline::range_of(Composable const* object) const noexcept
+{
+    int64_t const row = row_of(object);
+    if (row < 0)
+    {
+        return std::nullopt;
+    }
+    double const rate = _structure.rate()[row];
+    return TimeRange(
+        RationalTime(_structure.start()[row], rate),
+        RationalTime(_structure.duration()[row], rate));
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/clip.h"
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/playbackSchedule.h"
+#include "opentimelineio/structureTable.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/version.h"
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * An immutable copy of a timeline, for sharing between many threads.
+ *
+ * SerializableObjects make no promises about concurrent use: queries may
+ * fill in caches, and retaining or releasing an object locks it.  A frozen
+ * timeline is a deep copy that nothing else refers to, made once, with
+ * every cache that queries would fill already filled, and with the tables
+ * that most queries need (the structure, the playback schedule and the
+ * clips) built up front.  Those tables hold plain pointers, so walking
+ * them does not touch reference counts.
+ *
+ * Once freeze() has returned, any number of threads may query a frozen
+ * timeline at once, without locks, through its own accessors and through
+ * the const member functions of the objects it hands out.  Nothing may
+ * edit those objects; they are only handed out as pointers to const, and
+ * casting that away is undefined behavior.  Retaining them (in a Retainer
+ * or from Python) is safe but takes a lock, and keeps only that object,
+ * not the frozen timeline, alive.
+ */
+class FrozenTimeline
+{
+public:
+    /// Copy a timeline and freeze the copy.  Returns null, and sets
+    /// error_status, if the timeline cannot be copied or tabulated.
+    static std::shared_ptr<FrozenTimeline const>
+    freeze(Timeline const* timeline, ErrorStatus* error_status = nullptr);
+
+    FrozenTimeline(FrozenTimeline const&)            = delete;
+    FrozenTimeline& operator=(FrozenTimeline const&) = delete;
+
+    /// The frozen copy of the timeline.
+    Timeline const* timeline() const noexcept { return _timeline; }
+
+    /// The structure of the timeline's tracks; see StructureTable.
+    StructureTable const& structure() const noexcept { return _structure; }
+
+    /// What the timeline plays; see PlaybackSchedule.
+    PlaybackSchedule const& schedule() const noexcept { return *_schedule; }
+
+    /// Every clip, in the order of structure().
+    std::vector<Clip const*> const& clips() const noexcept { return _clips; }
+
+    /// The row of an object in structure(), or -1 if it is not in the
+    /// frozen timeline.
+    int64_t row_of(Composable const* object) const noexcept;
+
+    /// The range of an object in the time of the timeline's tracks, as
+    /// StructureTable tabulates it: the global start time is not added,
+    /// and time effects are not applied.
+    std::optional<TimeRange> range_of(Composable const* object) const noexcept;
+
+private:
+    FrozenTimeline() = default;
+
+    SerializableObject::Retainer<Timeline>         _timeline;
+    StructureTable                                 _structure;
+    std::shared_ptr<PlaybackSchedule const>        _schedule;
+    std::vector<Clip const*>                       _clips;
+    std::unordered_map<Composable const*, int64_t> _rows;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -3,8 +3,170 @@
 
 #include "opentimelineio/imageSequenceReference.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+namespace {
+
+// Builds the target URLs of a sequence.  Everything but the frame number is
+// put together once, so each URL is a few appends to a string that can be
+// reused.
+class TargetUrlFormatter
+{
+public:
+    TargetUrlFormatter(
+        std::string const& target_url_base,
+        std::string const& name_prefix,
+        std::string const& name_suffix,
+        int                start_frame,
+        int                frame_step,
+        int                frame_zero_padding)
+        : _prefix(target_url_base)
+        , _suffix(name_suffix)
+        , _start_frame(start_frame)
+        , _frame_step(frame_step)
+        , _frame_zero_padding(frame_zero_padding)
+    {
+        // If the base does not include a trailing slash, add it
+        if (!_prefix.empty() && _prefix.back() != '/')
+        {
+            _prefix += '/';
+        }
+        _prefix += name_prefix;
+    }
+
+    void format(int image_number, std::string& url) const
+    {
+        int const file_image_num = _start_frame + (image_number * _frame_step);
+        unsigned const magnitude = file_image_num < 0
+                                       ? 0u - unsigned(file_image_num)
+                                       : unsigned(file_image_num);
+
+        char       digits[16];
+        auto const length = size_t(
+            std::to_chars(digits, digits + sizeof(digits), magnitude).ptr
+            - digits);
+
+        url.assign(_prefix);
+        if (file_image_num < 0)
+        {
+            url += '-';
+        }
+        if (static_cast<int>(length) < _frame_zero_padding)
+        {
+            url.append(_frame_zero_padding - length, '0');
+        }
+        url.append(digits, length);
+        url.append(_suffix);
+    }
+
+private:
+    std::string _prefix;
+    std::string _suffix;
+    int         _start_frame;
+    int         _frame_step;
+    int         _frame_zero_padding;
+};
+
+// The first image presented at or after x images from the start, allowing
+// for x being a little off a whole number after converting rates.
+int64_t
+image_at_or_after(double x)
+{
+    double const nearest = std::round(x);
+    return int64_t(std::abs(x - nearest) < 1e-9 ? nearest : std::ceil(x));
+}
+
+// Call function with the number of each image presented over range, or -1
+// for a black frame.
+template <typename Function>
+bool
+for_each_image_in_range(
+    ImageSequenceReference const& reference,
+    TimeRange const&              range,
+    Function&&                    function,
+    ErrorStatus*                  error_status)
+{
+    auto const   available_range = reference.available_range();
+    double const rate            = reference.rate();
+    int const    frame_step      = reference.frame_step();
+    auto const   policy          = reference.missing_frame_policy();
+    if (rate == 0)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::ILLEGAL_INDEX,
+                "Zero rate sequence has no frames.");
+        }
+        return false;
+    }
+    else if (!available_range.has_value() || frame_step <= 0)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::ILLEGAL_INDEX,
+                "Sequence has no available range or frame step.");
+        }
+        return false;
+    }
+
+    // The images are presented one frame duration apart from the start of
+    // the available range, at a rate of rate / frame_step.
+    double const       playback_rate = rate / (double) frame_step;
+    RationalTime const start         = available_range->start_time();
+    int64_t const      count =
+        available_range->duration().to_frames(playback_rate);
+    int64_t const first = image_at_or_after(
+        (range.start_time() - start).value_rescaled_to(playback_rate));
+    int64_t const end = std::max(
+        first,
+        image_at_or_after((range.end_time_exclusive() - start)
+                              .value_rescaled_to(playback_rate)));
+
+    bool const outside = first < 0 || end > count;
+    if (outside
+        && (policy == ImageSequenceReference::MissingFramePolicy::error
+            || (policy == ImageSequenceReference::MissingFramePolicy::hold
+                && count == 0)))
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::ILLEGAL_INDEX,
+                "Range extends outside of the sequence.");
+        }
+        return false;
+    }
+
+    bool const hold = policy == ImageSequenceReference::MissingFramePolicy::hold;
+    for (int64_t i = first; i < end; ++i)
+    {
+        int64_t image_number = i;
+        if (i < 0)
+        {
+            image_number = hold ? 0 : -1;
+        }
+        else if (i >= count)
+        {
+            image_number = hold ? count - 1 : -1;
+        }
+        function(int(image_number));
+    }
+
+    if (error_status)
+    {
+        *error_status = ErrorStatus(ErrorStatus::OK);
+    }
+    return true;
+}
+
+} // namespace
+
 ImageSequenceReference::ImageSequenceReference(
     std::string const&                           target_url_base,
     std::string const&                           name_prefix,
@@ -40,13 +202,13 @@ ImageSequenceReference::frame_duration() const noexcept
 int
 ImageSequenceReference::end_frame() const
 {
-    if (!this->available_range().has_value())
+    auto const available_range = this->available_range();
+    if (!available_range.has_value())
     {
         return _start_frame;
     }
 
-    int num_frames =
-        this->available_range().value().duration().to_frames(_rate);
+    int num_frames = available_range.value().duration().to_frames(_rate);
 
     // Subtract 1 for inclusive frame ranges
     return (_start_frame + num_frames - 1);
@@ -55,14 +217,15 @@ ImageSequenceReference::end_frame() const
 int
 ImageSequenceReference::number_of_images_in_sequence() const
 {
-    if (!this->available_range().has_value())
+    auto const available_range = this->available_range();
+    if (!available_range.has_value())
     {
         return 0;
     }
 
     double playback_rate = (_rate / (double) _frame_step);
     int    num_frames =
-        this->available_range().value().duration().to_frames(playback_rate);
+        available_range.value().duration().to_frames(playback_rate);
     return num_frames;
 }
 
@@ -128,35 +291,15 @@ ImageSequenceReference::target_url_for_image_number(
         }
         return std::string();
     }
-    const int  file_image_num = _start_frame + (image_number * _frame_step);
-    const bool is_negative    = (file_image_num < 0);
-
-    std::string image_num_string = std::to_string(abs(file_image_num));
-
-    std::string zero_pad = std::string();
-    if (static_cast<int>(image_num_string.length()) < _frame_zero_padding)
-    {
-        zero_pad =
-            std::string(_frame_zero_padding - image_num_string.length(), '0');
-    }
-
-    std::string sign = std::string();
-    if (is_negative)
-    {
-        sign = "-";
-    }
-
-    // If the base does not include a trailing slash, add it
-    std::string path_sep            = std::string();
-    const auto  target_url_base_len = _target_url_base.length();
-    if (target_url_base_len > 0
-        && _target_url_base.compare(target_url_base_len - 1, 1, "/") != 0)
-    {
-        path_sep = "/";
-    }
-
-    std::string out_string = _target_url_base + path_sep + _name_prefix + sign
-                             + zero_pad + image_num_string + _name_suffix;
+    std::string out_string;
+    TargetUrlFormatter(
+        _target_url_base,
+        _name_prefix,
+        _name_suffix,
+        _start_frame,
+        _frame_step,
+        _frame_zero_padding)
+        .format(image_number, out_string);
     if (error_status)
     {
         *error_status = ErrorStatus(ErrorStatus::OK);
@@ -183,6 +326,93 @@ ImageSequenceReference::presentation_time_for_image_number(
     return time_multiplier.applied_to(frame_duration());
 }
 
+bool
+ImageSequenceReference::image_numbers_in_range(
+    TimeRange const&  range,
+    std::vector<int>& image_numbers,
+    ErrorStatus*      error_status) const
+{
+    image_numbers.clear();
+    return for_each_image_in_range(
+        *this,
+        range,
+        [&image_numbers](int image_number) {
+            image_numbers.push_back(image_number);
+        },
+        error_status);
+}
+
+bool
+ImageSequenceReference::target_urls_in_range(
+    TimeRange const&          range,
+    std::vector<std::string>& urls,
+    ErrorStatus*              error_status) const
+{
+    TargetUrlFormatter const formatter(
+        _target_url_base,
+        _name_prefix,
+        _name_suffix,
+        _start_frame,
+        _frame_step,
+        _frame_zero_padding);
+
+    size_t     size   = 0;
+    bool const result = for_each_image_in_range(
+        *this,
+        range,
+        [&](int image_number) {
+            if (size == urls.size())
+            {
+                urls.emplace_back();
+            }
+            std::string& url = urls[size++];
+            if (image_number < 0)
+            {
+                url.clear();
+            }
+            else
+            {
+                formatter.format(image_number, url);
+            }
+        },
+        error_status);
+    urls.resize(result ? size : 0);
+    return result;
+}
+
+bool
+ImageSequenceReference::for_each_target_url_in_range(
+    TimeRange const& range,
+    std::function<void(int image_number, std::string const& url)> const&
+                 function,
+    ErrorStatus* error_status) const
+{
+    TargetUrlFormatter const formatter(
+        _target_url_base,
+        _name_prefix,
+        _name_suffix,
+        _start_frame,
+        _frame_step,
+        _frame_zero_padding);
+
+    std::string url;
+    return for_each_image_in_range(
+        *this,
+        range,
+        [&](int image_number) {
+            if (image_number < 0)
+            {
+                url.clear();
+            }
+            else
+            {
+                formatter.format(image_number, url);
+            }
+            function(image_number, url);
+        },
+        error_status);
+}
+
 bool
 ImageSequenceReference::read_from(Reader& reader)
 {
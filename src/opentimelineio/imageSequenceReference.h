@@ -6,6 +6,9 @@
 #include "opentimelineio/mediaReference.h"
 #include "opentimelineio/version.h"
 
+#include <functional>
+#include <vector>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
 class ImageSequenceReference final : public MediaReference
@@ -109,6 +112,36 @@ public:
         int          image_number,
         ErrorStatus* error_status = nullptr) const;
 
+    /// Get the numbers of the images presented over a range of time, in
+    /// the space of the available range, in order.
+    ///
+    /// Times outside of the sequence are handled by the missing frame
+    /// policy: with error, the result is an ILLEGAL_INDEX error; with hold,
+    /// the first or last image is repeated; and with black, the image
+    /// number is -1.  The contents of image_numbers are replaced.
+    bool image_numbers_in_range(
+        TimeRange const&  range,
+        std::vector<int>& image_numbers,
+        ErrorStatus*      error_status = nullptr) const;
+
+    /// Get the target URLs of the images presented over a range of time,
+    /// as image_numbers_in_range().  The URL of a black frame is empty.
+    /// The strings already in urls are reused, so that filling the same
+    /// vector again does not allocate.
+    bool target_urls_in_range(
+        TimeRange const&          range,
+        std::vector<std::string>& urls,
+        ErrorStatus*              error_status = nullptr) const;
+
+    /// Call a function with the number and target URL of each image
+    /// presented over a range of time, as image_numbers_in_range().  The
+    /// URL is only valid during the call.
+    bool for_each_target_url_in_range(
+        TimeRange const& range,
+        std::function<void(int image_number, std::string const& url)> const&
+                     function,
+        ErrorStatus* error_status = nullptr) const;
+
 protected:
     virtual ~ImageSequenceReference();
 
@@ -37,7 +37,11 @@ public:
 
     bool enabled() const { return _enabled; };
 
-    void set_enabled(bool enabled) { _enabled = enabled; }
+    void set_enabled(bool enabled)
+    {
+        _enabled = enabled;
+        _timing_changed();
+    }
 
     std::optional<TimeRange> source_range() const noexcept
     {
@@ -47,6 +51,7 @@ public:
     void set_source_range(std::optional<TimeRange> const& source_range)
     {
         _source_range = source_range;
+        _timing_changed();
     }
 
     std::vector<Retainer<Effect>>& effects() noexcept { return _effects; }
@@ -0,0 +1,555 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/mediaTimeEvaluator.h"
+#include "opentimelineio/linearTimeWarp.h"
+#include "opentimelineio/transition.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+using Segment = MediaTimeEvaluator::Segment;
+
+// The function from track time, as a value at the track's rate, to the
+// time inside an item: value * scale + offset, at rate.
+struct Affine
+{
+    double scale;
+    double offset;
+    double rate;
+};
+
+double
+time_scalar_of(Item const* item)
+{
+    double scalar = 1;
+    for (auto const& effect: item->effects())
+    {
+        if (auto warp = dynamic_cast<LinearTimeWarp const*>(effect.value))
+        {
+            scalar *= warp->time_scalar();
+        }
+    }
+    return scalar;
+}
+
+bool
+starts_before(Segment const& a, Segment const& b)
+{
+    return a.start < b.start;
+}
+
+// Cut the spans of above out of those of below and add above to them.
+// Both must be sorted, and neither may overlap itself.
+void
+overlay(std::vector<Segment>& below, std::vector<Segment> const& above)
+{
+    if (above.empty())
+    {
+        return;
+    }
+
+    std::vector<Segment> result;
+    result.reserve(below.size() + above.size());
+    size_t first = 0;
+    for (Segment const& segment: below)
+    {
+        while (first < above.size() && above[first].end <= segment.start)
+        {
+            ++first;
+        }
+
+        double start = segment.start;
+        for (size_t i = first;
+             i < above.size() && above[i].start < segment.end;
+             ++i)
+        {
+            if (above[i].start > start)
+            {
+                result.push_back(segment);
+                result.back().start = start;
+                result.back().end   = above[i].start;
+            }
+            start = std::max(start, above[i].end);
+        }
+        if (start < segment.end)
+        {
+            result.push_back(segment);
+            result.back().start = start;
+        }
+    }
+
+    result.insert(result.end(), above.begin(), above.end());
+    std::sort(result.begin(), result.end(), starts_before);
+    below = std::move(result);
+}
+
+// Convert to_parent to the rate of range, and narrow the span of track
+// time [visible_start, visible_end) to where the parent is within range.
+// Returns whether any of the span is left.
+bool
+narrow_to_range(
+    Affine&          to_parent,
+    TimeRange const& range,
+    double&          visible_start,
+    double&          visible_end)
+{
+    double const rate = range.start_time().rate();
+    if (to_parent.rate != rate)
+    {
+        to_parent.scale *= rate / to_parent.rate;
+        to_parent.offset *= rate / to_parent.rate;
+        to_parent.rate = rate;
+    }
+    double const range_start = range.start_time().value();
+    double const range_end =
+        range_start + range.duration().value_rescaled_to(rate);
+
+    if (to_parent.scale == 0)
+    {
+        return to_parent.offset >= range_start && to_parent.offset < range_end
+               && visible_start < visible_end;
+    }
+
+    double start = (range_start - to_parent.offset) / to_parent.scale;
+    double end   = (range_end - to_parent.offset) / to_parent.scale;
+    if (to_parent.scale < 0)
+    {
+        std::swap(start, end);
+    }
+    visible_start = std::max(visible_start, start);
+    visible_end   = std::min(visible_end, end);
+    return visible_start < visible_end;
+}
+
+// Add the spans of time over which the clips in child are visible, and
+// those of the transitions within it, given the function from track time
+// to the time inside its parent, the range of child in its parent, and the
+// span of track time the parent is visible.
+bool
+collect_segments(
+    Composable const*                                child,
+    TimeRange const&                                 range,
+    Affine                                           to_parent,
+    double                                           visible_start,
+    double                                           visible_end,
+    std::vector<Segment>&                            segments,
+    std::vector<MediaTimeEvaluator::TransitionSpan>& transitions,
+    ErrorStatus*                                     error_status)
+{
+    auto item = dynamic_cast<Item const*>(child);
+    if (!item || !item->visible()
+        || !narrow_to_range(to_parent, range, visible_start, visible_end))
+    {
+        return true;
+    }
+    double const rate        = range.start_time().rate();
+    double const range_start = range.start_time().value();
+
+    // Parent time to the time inside the child: relative to the start of
+    // the child's range, converted to the rate of its trimmed range, scaled
+    // by its time effects and offset by the start of its trimmed range.
+    RationalTime const trimmed_start =
+        item->trimmed_range(error_status).start_time();
+    if (is_error(error_status))
+    {
+        return false;
+    }
+    double const trimmed_rate = trimmed_start.rate();
+    double const step_scale =
+        (trimmed_rate == rate ? 1 : trimmed_rate / rate) * time_scalar_of(item);
+    Affine const to_child{
+        to_parent.scale * step_scale,
+        (to_parent.offset - range_start) * step_scale + trimmed_start.value(),
+        trimmed_rate
+    };
+
+    if (auto clip = dynamic_cast<Clip const*>(item))
+    {
+        segments.push_back(Segment{ visible_start,
+                                    visible_end,
+                                    to_child.scale,
+                                    to_child.offset,
+                                    to_child.rate,
+                                    clip,
+                                    clip->media_reference() });
+        return true;
+    }
+
+    auto composition = dynamic_cast<Composition const*>(item);
+    if (!composition)
+    {
+        return true;
+    }
+
+    auto const ranges = composition->range_of_all_children(error_status);
+    if (is_error(error_status))
+    {
+        return false;
+    }
+
+    // Later children of a stack are above the earlier ones, so each is laid
+    // over those before it; the children of anything else follow each other.
+    bool const           layered = dynamic_cast<Stack const*>(composition);
+    std::vector<Segment> stacked;
+    std::vector<Segment> layer;
+    auto const&          children = composition->children();
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        Composable const* grandchild = children[i];
+        auto const        found      = ranges.find(children[i].value);
+        if (found == ranges.end())
+        {
+            continue;
+        }
+
+        if (auto transition = dynamic_cast<Transition const*>(grandchild))
+        {
+            Affine to_transition = to_child;
+            double start         = visible_start;
+            double end           = visible_end;
+            if (narrow_to_range(to_transition, found->second, start, end))
+            {
+                transitions.push_back(MediaTimeEvaluator::TransitionSpan{
+                    start,
+                    end,
+                    transition,
+                    i > 0 ? dynamic_cast<Item const*>(children[i - 1].value)
+                          : nullptr,
+                    i + 1 < children.size()
+                        ? dynamic_cast<Item const*>(children[i + 1].value)
+                        : nullptr });
+            }
+            continue;
+        }
+
+        if (!collect_segments(
+                grandchild,
+                found->second,
+                to_child,
+                visible_start,
+                visible_end,
+                layered ? layer : segments,
+                transitions,
+                error_status))
+        {
+            return false;
+        }
+
+        if (layered)
+        {
+            std::sort(layer.begin(), layer.end(), starts_before);
+            if (stacked.empty())
+            {
+                stacked.swap(layer);
+            }
+            else
+            {
+                overlay(stacked, layer);
+            }
+            layer.clear();
+        }
+    }
+    segments.insert(segments.end(), stacked.begin(), stacked.end());
+    return true;
+}
+
+} // namespace
+
+MediaTimeEvaluator::MediaTimeEvaluator(Timeline const* timeline)
+    : _timeline(timeline)
+    , _stack_generation(0)
+    , _compiled(false)
+{}
+
+bool
+MediaTimeEvaluator::is_current() const noexcept
+{
+    if (!_compiled)
+    {
+        return false;
+    }
+    Stack const* stack = _timeline ? _timeline->tracks() : nullptr;
+    return stack == _stack.value
+           && (!stack || stack->_timing_generation == _stack_generation);
+}
+
+size_t
+MediaTimeEvaluator::track_count(ErrorStatus* error_status)
+{
+    return _ensure_compiled(error_status) ? _tracks.size() : 0;
+}
+
+std::vector<MediaTimeEvaluator::Result>
+MediaTimeEvaluator::evaluate(RationalTime time, ErrorStatus* error_status)
+{
+    std::vector<Result> results;
+    if (!_ensure_compiled(error_status))
+    {
+        return results;
+    }
+
+    results.reserve(_tracks.size());
+    for (size_t i = 0; i < _tracks.size(); ++i)
+    {
+        results.push_back(evaluate(i, time, error_status));
+    }
+    return results;
+}
+
+MediaTimeEvaluator::Result
+MediaTimeEvaluator::evaluate(
+    size_t       track_index,
+    RationalTime time,
+    ErrorStatus* error_status)
+{
+    Result result;
+    if (!_check_track_index(track_index, error_status))
+    {
+        return result;
+    }
+
+    CompiledTrack const& track = _tracks[track_index];
+    double const         value = time.value_rescaled_to(track.rate);
+    auto const           found =
+        std::upper_bound(track.starts.begin(), track.starts.end(), value);
+    if (found == track.starts.begin())
+    {
+        return result;
+    }
+    Segment const& segment = track.segments[found - track.starts.begin() - 1];
+    if (value >= segment.end)
+    {
+        return result;
+    }
+
+    result.clip            = segment.clip;
+    result.media_reference = segment.media_reference;
+    result.media_time      = RationalTime(
+        value * segment.scale + segment.offset,
+        segment.media_rate);
+    return result;
+}
+
+MediaTimeEvaluator::Batch
+MediaTimeEvaluator::evaluate(
+    size_t                             track_index,
+    opentime::RationalTimeArray const& times,
+    ErrorStatus*                       error_status)
+{
+    Batch batch;
+    if (!_check_track_index(track_index, error_status))
+    {
+        return batch;
+    }
+
+    CompiledTrack const& track = _tracks[track_index];
+    size_t const         count = times.size();
+    double const         rate  = track.rate;
+
+    // Start from the times at the track's rate, as by
+    // RationalTime::value_rescaled_to, and map them to media times in place.
+    batch.clips.resize(count, nullptr);
+    batch.media_references.resize(count, nullptr);
+    batch.media_times = times;
+    batch.media_times.rescale_to(rate);
+    double* values = batch.media_times.values();
+    double* rates  = batch.media_times.rates();
+
+    // Sorted times, such as the frames of a shot, come in runs that fall in
+    // the same segment, so each run is mapped with one multiply and add per
+    // time, and the segment after it is tried before searching for the next.
+    size_t const segment_count = track.segments.size();
+    size_t       hint          = 0;
+    for (size_t i = 0; i < count;)
+    {
+        double const v = values[i];
+        size_t       j = hint;
+        if (j + 1 < segment_count && v >= track.segments[j].end)
+        {
+            ++j;
+        }
+        if (j >= segment_count || track.starts[j] > v
+            || v >= track.segments[j].end)
+        {
+            auto const found =
+                std::upper_bound(track.starts.begin(), track.starts.end(), v);
+            j = size_t(found - track.starts.begin()) - 1;
+            if (found == track.starts.begin() || v >= track.segments[j].end)
+            {
+                values[i] = 0;
+                rates[i]  = 1;
+                ++i;
+                continue;
+            }
+        }
+
+        Segment const& segment = track.segments[j];
+        size_t         end     = i + 1;
+        while (end < count && values[end] >= segment.start
+               && values[end] < segment.end)
+        {
+            ++end;
+        }
+        for (size_t k = i; k < end; ++k)
+        {
+            values[k] = values[k] * segment.scale + segment.offset;
+            rates[k]  = segment.media_rate;
+        }
+        std::fill(
+            batch.clips.begin() + i,
+            batch.clips.begin() + end,
+            segment.clip);
+        std::fill(
+            batch.media_references.begin() + i,
+            batch.media_references.begin() + end,
+            segment.media_reference);
+        hint = j;
+        i    = end;
+    }
+    return batch;
+}
+
+std::vector<MediaTimeEvaluator::Segment> const&
+MediaTimeEvaluator::segments(size_t track_index, ErrorStatus* error_status)
+{
+    static std::vector<Segment> const empty;
+    if (!_check_track_index(track_index, error_status))
+    {
+        return empty;
+    }
+    return _tracks[track_index].segments;
+}
+
+double
+MediaTimeEvaluator::track_rate(size_t track_index, ErrorStatus* error_status)
+{
+    if (!_check_track_index(track_index, error_status))
+    {
+        return 1;
+    }
+    return _tracks[track_index].rate;
+}
+
+std::vector<MediaTimeEvaluator::TransitionSpan> const&
+MediaTimeEvaluator::transitions(size_t track_index, ErrorStatus* error_status)
+{
+    static std::vector<TransitionSpan> const empty;
+    if (!_check_track_index(track_index, error_status))
+    {
+        return empty;
+    }
+    return _tracks[track_index].transitions;
+}
+
+bool
+MediaTimeEvaluator::_ensure_compiled(ErrorStatus* error_status)
+{
+    return is_current() || _compile(error_status);
+}
+
+bool
+MediaTimeEvaluator::_check_track_index(
+    size_t       track_index,
+    ErrorStatus* error_status)
+{
+    if (!_ensure_compiled(error_status))
+    {
+        return false;
+    }
+    if (track_index >= _tracks.size())
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::ILLEGAL_INDEX,
+                "track index out of range");
+        }
+        return false;
+    }
+    return true;
+}
+
+bool
+MediaTimeEvaluator::_compile(ErrorStatus* error_status)
+{
+    _compiled = false;
+    if (!_timeline || _timeline->tracks() != _stack.value)
+    {
+        _tracks.clear();
+    }
+    _stack = _timeline ? _timeline->tracks() : nullptr;
+    if (!_stack)
+    {
+        _compiled = true;
+        return true;
+    }
+
+    auto const ranges = _stack->range_of_all_children(error_status);
+    if (is_error(error_status))
+    {
+        return false;
+    }
+
+    // A top-level child that is the same object with the same timing
+    // generation as when it was last compiled has not changed, so its table
+    // is kept; only the tables of children that were edited are compiled.
+    std::vector<CompiledTrack> previous;
+    previous.swap(_tracks);
+    _tracks.reserve(_stack->children().size());
+
+    double const infinity = std::numeric_limits<double>::infinity();
+    for (auto const& child: _stack->children())
+    {
+        auto const kept = std::find_if(
+            previous.begin(),
+            previous.end(),
+            [&child](CompiledTrack const& track) {
+                return track.child.value == child.value
+                       && track.generation == child->_timing_generation;
+            });
+        if (kept != previous.end())
+        {
+            _tracks.push_back(std::move(*kept));
+            kept->child = nullptr;
+            continue;
+        }
+
+        TimeRange const range = ranges.at(child.value);
+        CompiledTrack   track;
+        track.child      = child.value;
+        track.generation = child->_timing_generation;
+        track.rate       = range.start_time().rate();
+        if (!collect_segments(
+                child,
+                range,
+                Affine{ 1, 0, track.rate },
+                -infinity,
+                infinity,
+                track.segments,
+                track.transitions,
+                error_status))
+        {
+            _tracks.clear();
+            return false;
+        }
+
+        std::sort(track.segments.begin(), track.segments.end(), starts_before);
+        track.starts.reserve(track.segments.size());
+        for (Segment const& segment: track.segments)
+        {
+            track.starts.push_back(segment.start);
+        }
+        _tracks.push_back(std::move(track));
+    }
+
+    _stack_generation = _stack->_timing_generation;
+    _compiled         = true;
+    return true;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentime/rationalTimeArray.h"
+#include "opentimelineio/clip.h"
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/transition.h"
+#include "opentimelineio/version.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * Evaluates a timeline at a time, giving for each track the clip that is
+ * showing, its media reference, and the time in its media.
+ *
+ * The timeline is compiled into a table per track (per child of
+ * Timeline::tracks(), which is usually a Track) of the spans of time that
+ * each clip is visible for, however deeply it is nested, each with the
+ * affine function from timeline time to media time over that span.
+ * Evaluating a time is then a search of that table and a multiply and add,
+ * and evaluating a batch of times, such as every frame of a shot, is a few
+ * loops over arrays.
+ *
+ * Timeline time here is the time of Timeline::tracks(), starting at zero;
+ * the global start time is not added.  Within a stack, a higher child hides
+ * what is below it wherever it has a clip, and a gap or a disabled item
+ * shows what is below.  Transitions are not evaluated: each clip is shown
+ * for its trimmed range only, and the spans of the transitions are listed
+ * separately by transitions().  LinearTimeWarps (and so FreezeFrames) on
+ * every item from the track down to the clip scale the time relative to
+ * the start of the item's trimmed range; other effects are ignored.
+ *
+ * As with TimeMapping, the tables are compiled again the next time they
+ * are used after anything in the timeline is edited through its API, and
+ * then only those of the tracks that were edited.  invalidate() must be
+ * called after edits that are not, such as changing an effect.  The
+ * evaluator retains the timeline and is not safe to use from several
+ * threads at once.
+ */
+class MediaTimeEvaluator
+{
+public:
+    /// The result of evaluating one track at one time.
+    struct Result
+    {
+        /// The clip that is showing, or null if there is none.
+        Clip const* clip = nullptr;
+
+        /// The active media reference of the clip.
+        MediaReference const* media_reference = nullptr;
+
+        /// The time in the media, at the rate of the clip's trimmed range.
+        RationalTime media_time;
+    };
+
+    /// The results of evaluating one track at many times, in arrays
+    /// parallel to the times.
+    struct Batch
+    {
+        std::vector<Clip const*>           clips;
+        std::vector<MediaReference const*> media_references;
+        opentime::RationalTimeArray        media_times;
+    };
+
+    MediaTimeEvaluator(Timeline const* timeline);
+
+    Timeline const* timeline() const noexcept { return _timeline; }
+
+    /// The number of tracks, compiling first if need be.
+    size_t track_count(ErrorStatus* error_status = nullptr);
+
+    /// Evaluate every track at a time.
+    std::vector<Result>
+    evaluate(RationalTime time, ErrorStatus* error_status = nullptr);
+
+    /// Evaluate one track at a time.
+    Result evaluate(
+        size_t       track_index,
+        RationalTime time,
+        ErrorStatus* error_status = nullptr);
+
+    /// Evaluate one track at many times.  Times in increasing order are
+    /// looked up fastest.
+    Batch evaluate(
+        size_t                             track_index,
+        opentime::RationalTimeArray const& times,
+        ErrorStatus*                       error_status = nullptr);
+
+    /// Whether the compiled tables are up to date with the timeline.
+    bool is_current() const noexcept;
+
+    /// Force every table to be compiled again the next time they are used.
+    void invalidate() noexcept
+    {
+        _compiled = false;
+        _tracks.clear();
+    }
+
+    /// The spans of one track, in increasing order of start time: the
+    /// clip visible over [start, end) at the track's rate, and the media
+    /// time as value * scale + offset at media_rate.
+    struct Segment
+    {
+        double                start;
+        double                end;
+        double                scale;
+        double                offset;
+        double                media_rate;
+        Clip const*           clip;
+        MediaReference const* media_reference;
+    };
+
+    /// The rate of the times in the table of one track, which is that of
+    /// the start of the track's range, compiling first if need be.
+    double
+    track_rate(size_t track_index, ErrorStatus* error_status = nullptr);
+
+    /// The compiled table of one track, compiling first if need be.
+    std::vector<Segment> const&
+    segments(size_t track_index, ErrorStatus* error_status = nullptr);
+
+    /// The span of a transition in a track, in the same terms as a
+    /// Segment, with the items either side of it.  The segments either
+    /// side are not changed by a transition; how to blend them is up to
+    /// the caller.
+    struct TransitionSpan
+    {
+        double            start;
+        double            end;
+        Transition const* transition;
+        Item const*       outgoing;
+        Item const*       incoming;
+    };
+
+    /// The transitions in one track, compiling first if need be.
+    std::vector<TransitionSpan> const&
+    transitions(size_t track_index, ErrorStatus* error_status = nullptr);
+
+private:
+    struct CompiledTrack
+    {
+        SerializableObject::Retainer<Composable> child;
+        uint64_t                                 generation = 0;
+        double                                   rate       = 1;
+        std::vector<Segment>                     segments;
+        std::vector<double>                      starts;
+        std::vector<TransitionSpan>              transitions;
+    };
+
+    bool _ensure_compiled(ErrorStatus* error_status);
+    bool _compile(ErrorStatus* error_status);
+    bool _check_track_index(size_t track_index, ErrorStatus* error_status);
+
+    SerializableObject::Retainer<Timeline> _timeline;
+    SerializableObject::Retainer<Stack>    _stack;
+    uint64_t                               _stack_generation;
+    std::vector<CompiledTrack>             _tracks;
+    bool                                   _compiled;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -0,0 +1,499 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/mediaVerification.h"
+#include "opentimelineio/externalReference.h"
+#include "opentimelineio/imageSequenceReference.h"
+#include "parallelFor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <filesystem>
+#include <unordered_map>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+struct FileCheck
+{
+    std::string path;
+    size_t      name_start;
+    bool        exists = false;
+    uint64_t    size   = 0;
+};
+
+struct DirectoryCheck
+{
+    std::string         path;
+    std::vector<size_t> files;
+};
+
+bool
+is_separator(char c)
+{
+    return c == '/' || c == char(fs::path::preferred_separator);
+}
+
+// The files to check, each once however many clips use it, grouped by
+// directory.  Paths are kept as strings until they are checked, since
+// building an fs::path for each of millions of images costs more than
+// checking many of them.
+class FileChecks
+{
+public:
+    size_t add(std::string const& path)
+    {
+        auto const found = _file_indices.find(path);
+        if (found != _file_indices.end())
+        {
+            return found->second;
+        }
+
+        size_t name_start = path.size();
+        while (name_start > 0 && !is_separator(path[name_start - 1]))
+        {
+            --name_start;
+        }
+
+        size_t const index = _files.size();
+        _files.push_back(FileCheck{ path, name_start });
+        _file_indices.emplace(path, index);
+
+        std::string directory = path.substr(0, name_start);
+        if (directory.empty())
+        {
+            directory = ".";
+        }
+        auto const inserted =
+            _directory_indices.emplace(directory, _directories.size());
+        if (inserted.second)
+        {
+            _directories.push_back(DirectoryCheck{ directory, {} });
+        }
+        _directories[inserted.first->second].files.push_back(index);
+        return index;
+    }
+
+    FileCheck const& operator[](size_t index) const { return _files[index]; }
+
+    void run(MediaVerificationOptions const& options)
+    {
+        // Each directory, and so each file, is checked by one thread.
+        parallel_for(
+            _directories.size(),
+            parallel_thread_count(options.thread_count, _directories.size()),
+            [&](size_t i) { check(_directories[i], options); });
+    }
+
+private:
+    void check(
+        DirectoryCheck const&           directory,
+        MediaVerificationOptions const& options)
+    {
+        if (directory.files.size() >= options.listing_threshold
+            && check_listing(directory, options))
+        {
+            return;
+        }
+
+        for (size_t index: directory.files)
+        {
+            std::error_code error;
+            FileCheck&      file = _files[index];
+            fs::path const  path(file.path);
+            file.exists = fs::is_regular_file(path, error);
+            if (file.exists && options.read_sizes)
+            {
+                file.size   = fs::file_size(path, error);
+                file.exists = !error && file.size > 0;
+            }
+        }
+    }
+
+    // Check the files of a directory by listing it.  On network file
+    // systems, listing a directory typically also fetches the attributes of
+    // its files, so reading the sizes of the files found afterwards does not
+    // go back to the server.  Returns false, having checked nothing, if the
+    // directory could not be listed.
+    bool check_listing(
+        DirectoryCheck const&           directory,
+        MediaVerificationOptions const& options)
+    {
+        std::error_code                                       error;
+        std::unordered_map<std::string, fs::directory_entry> entries;
+        for (fs::directory_iterator i(directory.path, error), end;
+             !error && i != end;
+             i.increment(error))
+        {
+            entries.emplace(i->path().filename().string(), *i);
+        }
+        if (error)
+        {
+            return false;
+        }
+
+        for (size_t index: directory.files)
+        {
+            FileCheck& file  = _files[index];
+            auto const found = entries.find(file.path.substr(file.name_start));
+            if (found == entries.end()
+                || !found->second.is_regular_file(error))
+            {
+                continue;
+            }
+            file.exists = true;
+            if (options.read_sizes)
+            {
+                file.size   = found->second.file_size(error);
+                file.exists = !error && file.size > 0;
+            }
+        }
+        return true;
+    }
+
+    std::vector<FileCheck>                  _files;
+    std::vector<DirectoryCheck>             _directories;
+    std::unordered_map<std::string, size_t> _file_indices;
+    std::unordered_map<std::string, size_t> _directory_indices;
+};
+
+int
+hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    c = char(std::tolower(static_cast<unsigned char>(c)));
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+std::string
+percent_decoded(std::string const& text)
+{
+    if (text.find('%') == std::string::npos)
+    {
+        return text;
+    }
+
+    std::string result;
+    result.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        if (text[i] == '%' && i + 2 < text.size()
+            && hex_value(text[i + 1]) >= 0 && hex_value(text[i + 2]) >= 0)
+        {
+            result +=
+                char(hex_value(text[i + 1]) * 16 + hex_value(text[i + 2]));
+            i += 2;
+        }
+        else
+        {
+            result += text[i];
+        }
+    }
+    return result;
+}
+
+bool
+is_drive(std::string const& text, size_t position)
+{
+    return text.size() >= position + 2
+           && std::isalpha(static_cast<unsigned char>(text[position]))
+           && text[position + 1] == ':';
+}
+
+// The number of the first image of a sequence presented at or after a time,
+// as ImageSequenceReference counts them; it is outside of the sequence for
+// a time outside of the available range.
+int64_t
+image_at_or_after(ImageSequenceReference const& sequence, RationalTime time)
+{
+    double const playback_rate =
+        sequence.rate() / (double) sequence.frame_step();
+    double const x = (time - sequence.available_range()->start_time())
+                         .value_rescaled_to(playback_rate);
+    double const nearest = std::round(x);
+    return int64_t(std::abs(x - nearest) < 1e-9 ? nearest : std::ceil(x));
+}
+
+// The file index of an image outside of its sequence.
+constexpr size_t no_file = size_t(-1);
+
+} // namespace
+
+std::string
+filepath_from_url(std::string const& url)
+{
+    // A scheme is a letter followed by letters, digits, "+", "-" or ".",
+    // then a ":"; a single letter is a Windows drive rather than a scheme.
+    size_t scheme_end = 0;
+    while (scheme_end < url.size()
+           && (std::isalnum(static_cast<unsigned char>(url[scheme_end]))
+               || url[scheme_end] == '+' || url[scheme_end] == '-'
+               || url[scheme_end] == '.'))
+    {
+        ++scheme_end;
+    }
+    if (scheme_end < 2 || scheme_end >= url.size() || url[scheme_end] != ':'
+        || !std::isalpha(static_cast<unsigned char>(url[0])))
+    {
+        return url;
+    }
+
+    auto const same_letter = [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    };
+    if (scheme_end != 4
+        || !std::equal(url.begin(), url.begin() + 4, "file", same_letter))
+    {
+        return std::string();
+    }
+
+    std::string rest = url.substr(scheme_end + 1);
+    if (rest.compare(0, 2, "//") == 0)
+    {
+        size_t const      path_start = std::min(rest.find('/', 2), rest.size());
+        std::string const host       = rest.substr(2, path_start - 2);
+        std::string const path       = rest.substr(path_start);
+        if (host.empty() || host == "localhost")
+        {
+            rest = path;
+        }
+        else if (is_drive(host, 0))
+        {
+            // "file://C:/path"
+            rest = host + path;
+        }
+        else
+        {
+            // "file://host/share/path" is a UNC path.
+            rest = "//" + host + path;
+        }
+    }
+
+    std::string path = percent_decoded(rest);
+
+    // "file:///C:/path" names a Windows drive.
+    if (path.size() > 2 && path[0] == '/' && is_drive(path, 1))
+    {
+        path.erase(0, 1);
+    }
+    return path;
+}
+
+std::vector<MediaVerificationReport>
+verify_media(
+    Timeline const*                 timeline,
+    MediaVerificationOptions const& options,
+    ErrorStatus*                    error_status)
+{
+    std::vector<MediaVerificationReport> reports;
+    if (!timeline)
+    {
+        return reports;
+    }
+
+    auto const clips = timeline->find_clips(error_status);
+    if (is_error(error_status))
+    {
+        return reports;
+    }
+
+    std::string base = options.base_path;
+    if (!base.empty() && !is_separator(base.back()))
+    {
+        base += '/';
+    }
+    FileChecks files;
+    auto const add_file = [&](std::string const& url, size_t* index) {
+        std::string path = filepath_from_url(url);
+        if (path.empty())
+        {
+            return false;
+        }
+        if (!is_separator(path[0]) && !is_drive(path, 0))
+        {
+            path.insert(0, base);
+        }
+        *index = files.add(path);
+        return true;
+    };
+
+    // First gather the files of every clip, as the image number and the
+    // file index of each, then check them all at once.
+    std::vector<std::vector<std::pair<int, size_t>>> clip_files(clips.size());
+    reports.resize(clips.size());
+    for (size_t i = 0; i < clips.size(); ++i)
+    {
+        MediaVerificationReport& report = reports[i];
+        report.clip                     = clips[i];
+        report.media_reference          = clips[i]->media_reference();
+
+        if (auto external = dynamic_cast<ExternalReference const*>(
+                report.media_reference))
+        {
+            size_t index = 0;
+            if (external->target_url().empty())
+            {
+                continue;
+            }
+            if (!add_file(external->target_url(), &index))
+            {
+                report.status = MediaVerificationReport::unsupported_url;
+                continue;
+            }
+            clip_files[i].emplace_back(0, index);
+        }
+        else if (
+            auto sequence = dynamic_cast<ImageSequenceReference const*>(
+                report.media_reference))
+        {
+            ErrorStatus     range_error;
+            TimeRange const range = clips[i]->trimmed_range(&range_error);
+            if (is_error(range_error))
+            {
+                report.status = MediaVerificationReport::invalid_range;
+                continue;
+            }
+
+            // With the error policy, the images shown outside of the
+            // sequence are missing, so only the rest are looked for; hold
+            // and black fill in those images from the sequence or not at
+            // all.
+            bool const strict =
+                sequence->missing_frame_policy()
+                == ImageSequenceReference::MissingFramePolicy::error;
+            auto const available_range = sequence->available_range();
+            TimeRange  checked         = range;
+            if (strict && available_range)
+            {
+                checked = available_range->clamped(range);
+                if (checked.duration().value() < 0)
+                {
+                    checked = TimeRange(available_range->start_time());
+                }
+            }
+
+            bool supported = true;
+            sequence->for_each_target_url_in_range(
+                checked,
+                [&](int image_number, std::string const& url) {
+                    size_t index = 0;
+                    if (image_number < 0 || !supported
+                        || (!clip_files[i].empty()
+                            && clip_files[i].back().first == image_number))
+                    {
+                        return;
+                    }
+                    if (!add_file(url, &index))
+                    {
+                        supported = false;
+                        return;
+                    }
+                    clip_files[i].emplace_back(image_number, index);
+                },
+                &range_error);
+            if (is_error(range_error) || !supported)
+            {
+                report.status = is_error(range_error)
+                                    ? MediaVerificationReport::invalid_range
+                                    : MediaVerificationReport::unsupported_url;
+                clip_files[i].clear();
+                continue;
+            }
+
+            if (strict)
+            {
+                int64_t const first =
+                    image_at_or_after(*sequence, range.start_time());
+                int64_t const end = std::max(
+                    first,
+                    image_at_or_after(*sequence, range.end_time_exclusive()));
+                int64_t const count = sequence->number_of_images_in_sequence();
+
+                auto& images = clip_files[i];
+                for (int64_t image = std::max(first, count); image < end;
+                     ++image)
+                {
+                    images.emplace_back(int(image), no_file);
+                }
+                std::vector<std::pair<int, size_t>> before;
+                for (int64_t image = first; image < std::min(end, int64_t(0));
+                     ++image)
+                {
+                    before.emplace_back(int(image), no_file);
+                }
+                images.insert(images.begin(), before.begin(), before.end());
+            }
+        }
+    }
+
+    files.run(options);
+
+    for (size_t i = 0; i < clips.size(); ++i)
+    {
+        MediaVerificationReport& report = reports[i];
+        auto const&              images = clip_files[i];
+        if (images.empty())
+        {
+            continue;
+        }
+
+        auto const sequence =
+            dynamic_cast<ImageSequenceReference const*>(report.media_reference);
+        for (auto const& image: images)
+        {
+            if (image.second != no_file)
+            {
+                report.path = files[image.second].path;
+                break;
+            }
+        }
+
+        size_t found = 0;
+        for (auto const& image: images)
+        {
+            if (image.second != no_file && files[image.second].exists)
+            {
+                ++found;
+                report.size += files[image.second].size;
+            }
+            else if (
+                !report.missing_images.empty()
+                && report.missing_images.back().second + 1 == image.first)
+            {
+                report.missing_images.back().second = image.first;
+            }
+            else
+            {
+                report.missing_images.emplace_back(image.first, image.first);
+            }
+        }
+
+        report.status = found == images.size()
+                            ? MediaVerificationReport::ok
+                        : found == 0 ? MediaVerificationReport::missing
+                                     : MediaVerificationReport::incomplete;
+        if (sequence)
+        {
+            report.image_count = images.size();
+            report.violates_missing_frame_policy =
+                found < images.size()
+                && sequence->missing_frame_policy()
+                       == ImageSequenceReference::MissingFramePolicy::error;
+        }
+        else
+        {
+            report.missing_images.clear();
+        }
+    }
+
+    return reports;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
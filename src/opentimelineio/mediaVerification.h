@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/clip.h"
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/version.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/// Options for verify_media().
+struct MediaVerificationOptions
+{
+    /// The most threads to check files with; zero means one per hardware
+    /// thread.
+    int thread_count = 0;
+
+    /// The directory that relative target URLs are resolved against; they
+    /// are resolved against the current directory if this is empty.
+    std::string base_path;
+
+    /// A directory with at least this many files to check is listed once,
+    /// rather than each file being looked up on its own.
+    size_t listing_threshold = 8;
+
+    /// Whether to read the size of each file.  A file of zero bytes, such
+    /// as a render that failed, is then counted as missing.  Listing a
+    /// directory finds which files exist without looking each up, but on
+    /// some platforms reading sizes still looks up each file that is found.
+    bool read_sizes = true;
+};
+
+/// The media of one clip, as found by verify_media().
+struct MediaVerificationReport
+{
+    enum Status
+    {
+        /// Every file was found.
+        ok = 0,
+
+        /// No file was found.
+        missing = 1,
+
+        /// Some, but not all, of the images of a sequence were found.
+        incomplete = 2,
+
+        /// The clip has no media to check: it has a MissingReference or a
+        /// GeneratorReference, or no target.
+        not_checked = 3,
+
+        /// The target URL is not a local path or file URL.
+        unsupported_url = 4,
+
+        /// The images of a sequence to check cannot be worked out: the
+        /// sequence has no available range, a zero rate or a frame step
+        /// below one, or the clip's trimmed range is an error.
+        invalid_range = 5
+    };
+
+    SerializableObject::Retainer<Clip> clip;
+    MediaReference const*              media_reference = nullptr;
+    Status                             status          = not_checked;
+
+    /// The path of the file, or for a sequence, of its first image.
+    std::string path;
+
+    /// The total size of the files found, in bytes.
+    uint64_t size = 0;
+
+    /// For a sequence, the number of images the clip shows.
+    size_t image_count = 0;
+
+    /// For a sequence, each run of images that were not found, as the
+    /// first and last image numbers of the run.  With the error missing
+    /// frame policy, the images the clip shows outside of the available
+    /// range are missing, numbered below zero or from
+    /// number_of_images_in_sequence() on.
+    std::vector<std::pair<int, int>> missing_images;
+
+    /// Whether images are missing from a sequence whose missing frame
+    /// policy is error.
+    bool violates_missing_frame_policy = false;
+};
+
+/**
+ * Check that the media of every clip in a timeline exists.
+ *
+ * The active media reference of each clip is checked: an ExternalReference
+ * for its target file, and an ImageSequenceReference for each image shown
+ * over the clip's trimmed range.  Other references are not checked.
+ *
+ * The files are grouped by directory, and the directories are shared out
+ * between a bounded number of threads.  A directory with many files to
+ * check is listed once rather than each of its files being looked up,
+ * which on network storage is far faster.
+ *
+ * The reports are in the order of Timeline::find_clips().
+ */
+std::vector<MediaVerificationReport> verify_media(
+    Timeline const*                 timeline,
+    MediaVerificationOptions const& options      = MediaVerificationOptions(),
+    ErrorStatus*                    error_status = nullptr);
+
+/// Convert a target URL to a local path: "file:" URLs are decoded, and
+/// anything without a scheme is taken to be a path already.  Returns an
+/// empty string for other schemes.
+std::string filepath_from_url(std::string const& url);
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
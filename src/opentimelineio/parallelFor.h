@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/// Returns the number of threads to share count tasks between, for a
+/// requested thread_count where zero means one per hardware thread.
+inline size_t
+parallel_thread_count(int thread_count, size_t count)
+{
+    size_t const wanted = thread_count > 0
+                              ? size_t(thread_count)
+                              : size_t(std::thread::hardware_concurrency());
+    return std::min(std::max(wanted, size_t(1)), count);
+}
+
+/// Calls work(i) for each i below count on thread_count threads, the
+/// calling thread among them.  The indices are handed out one at a time,
+/// so a few slow tasks do not hold up the rest.
+template <typename Work>
+void
+parallel_for(size_t count, size_t thread_count, Work const& work)
+{
+    std::atomic<size_t> next(0);
+    auto const          run = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            work(i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_count; ++i)
+    {
+        threads.emplace_back(run);
+    }
+    run();
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
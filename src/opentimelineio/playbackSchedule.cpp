@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/playbackSchedule.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+PlaybackSchedule::Entry const*
+PlaybackSchedule::entry_at(size_t track_index, double time) const noexcept
+{
+    if (track_index >= _track_entries.size())
+    {
+        return nullptr;
+    }
+
+    // The entries of a track do not overlap, so the only one that can
+    // hold the time is the last that starts at or before it.
+    auto const& starts = _track_starts[track_index];
+    auto const  found  = std::upper_bound(starts.begin(), starts.end(), time);
+    if (found == starts.begin())
+    {
+        return nullptr;
+    }
+    Entry const& entry =
+        _entries[_track_entries[track_index][found - starts.begin() - 1]];
+    return time < entry.end ? &entry : nullptr;
+}
+
+void
+PlaybackSchedule::entries_at(
+    RationalTime               time,
+    std::vector<Entry const*>& entries) const
+{
+    entries.clear();
+    double const value = time.value_rescaled_to(_rate);
+    for (size_t i = 0; i < _track_entries.size(); ++i)
+    {
+        if (Entry const* entry = entry_at(i, value))
+        {
+            entries.push_back(entry);
+        }
+    }
+}
+
+size_t
+PlaybackSchedule::first_entry_after(RationalTime time) const noexcept
+{
+    // _entry_ends holds the latest end of the entries up to each one, so
+    // it is sorted even though the ends themselves are not.
+    return std::upper_bound(
+               _entry_ends.begin(),
+               _entry_ends.end(),
+               time.value_rescaled_to(_rate))
+           - _entry_ends.begin();
+}
+
+PlaybackScheduleCompiler::PlaybackScheduleCompiler(Timeline const* timeline)
+    : _evaluator(timeline)
+{}
+
+std::shared_ptr<PlaybackSchedule const>
+PlaybackScheduleCompiler::schedule(ErrorStatus* error_status)
+{
+    if (!is_current() && !_compile(error_status))
+    {
+        return nullptr;
+    }
+    return _schedule;
+}
+
+bool
+PlaybackScheduleCompiler::is_current() const noexcept
+{
+    Timeline const* timeline = _evaluator.timeline();
+    return _schedule && _evaluator.is_current()
+           && (timeline ? timeline->global_start_time() : std::nullopt)
+                  == _global_start_time;
+}
+
+bool
+PlaybackScheduleCompiler::_compile(ErrorStatus* error_status)
+{
+    _schedule.reset();
+
+    // Compile the tables of the tracks that changed first, so that the
+    // duration below is of the timeline as compiled.
+    size_t const track_count = _evaluator.track_count(error_status);
+    if (is_error(error_status))
+    {
+        return false;
+    }
+
+    std::shared_ptr<PlaybackSchedule> schedule(new PlaybackSchedule);
+    Timeline const* timeline = _evaluator.timeline();
+    _global_start_time =
+        timeline ? timeline->global_start_time() : std::nullopt;
+    if (timeline && timeline->tracks())
+    {
+        RationalTime const duration = timeline->duration(error_status);
+        if (is_error(error_status))
+        {
+            return false;
+        }
+        RationalTime const start = _global_start_time.value_or(
+            RationalTime(0, duration.rate()));
+        schedule->_rate  = start.rate();
+        schedule->_range = TimeRange(start, duration);
+    }
+    double const rate   = schedule->_rate;
+    double const global = schedule->_range.start_time().value();
+
+    // Rescale the tables of each track to global time: a time t in global
+    // time is (t - global) * to_track in the track.
+    auto& entries     = schedule->_entries;
+    auto& transitions = schedule->_transitions;
+    for (size_t i = 0; i < track_count; ++i)
+    {
+        auto const&  segments = _evaluator.segments(i, error_status);
+        auto const&  spans    = _evaluator.transitions(i, error_status);
+        double const to_track = _evaluator.track_rate(i, error_status) / rate;
+        if (is_error(error_status))
+        {
+            return false;
+        }
+
+        for (auto const& segment: segments)
+        {
+            double const scale = segment.scale * to_track;
+            entries.push_back(PlaybackSchedule::Entry{
+                segment.start / to_track + global,
+                segment.end / to_track + global,
+                i,
+                scale,
+                segment.offset - global * scale,
+                segment.media_rate,
+                segment.clip,
+                segment.media_reference });
+        }
+        for (auto const& span: spans)
+        {
+            transitions.push_back(PlaybackSchedule::TransitionEntry{
+                span.start / to_track + global,
+                span.end / to_track + global,
+                i,
+                span.transition,
+                span.outgoing,
+                span.incoming });
+        }
+    }
+
+    // Each track's entries are in order already and are added track by
+    // track, so a stable sort by start leaves ties in track order.
+    auto const starts_before = [](auto const& a, auto const& b) {
+        return a.start < b.start;
+    };
+    std::stable_sort(entries.begin(), entries.end(), starts_before);
+    std::stable_sort(transitions.begin(), transitions.end(), starts_before);
+
+    schedule->_track_entries.resize(track_count);
+    schedule->_track_starts.resize(track_count);
+    schedule->_entry_ends.reserve(entries.size());
+    double latest_end = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        schedule->_track_entries[entries[i].track_index].push_back(i);
+        schedule->_track_starts[entries[i].track_index].push_back(
+            entries[i].start);
+        latest_end = std::max(latest_end, entries[i].end);
+        schedule->_entry_ends.push_back(latest_end);
+    }
+
+    _schedule = std::move(schedule);
+    return true;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
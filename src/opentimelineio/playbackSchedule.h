@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/mediaTimeEvaluator.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/version.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * A flattened, sorted list of what a timeline plays: for every track, the
+ * spans of time over which each clip is visible, with the function from
+ * timeline time to media time over each span, and the spans of the
+ * transitions.
+ *
+ * Times are in global timeline time, at a single rate: the global start
+ * time is added, and the spans of tracks at other rates are rescaled.  A
+ * schedule is made by a PlaybackScheduleCompiler and does not change
+ * afterwards, so it can be handed to other threads, such as a player's,
+ * while the timeline goes on being edited.  It does not retain the
+ * timeline; the pointers in it are valid while the timeline's objects are.
+ */
+class PlaybackSchedule
+{
+public:
+    /// A clip visible over [start, end) in one track.  The time in its
+    /// media at a time t in the span is t * scale + offset, at media_rate.
+    struct Entry
+    {
+        double                start;
+        double                end;
+        size_t                track_index;
+        double                scale;
+        double                offset;
+        double                media_rate;
+        Clip const*           clip;
+        MediaReference const* media_reference;
+
+        /// The time in the media at a time in the span.
+        RationalTime media_time(double time) const noexcept
+        {
+            return RationalTime(time * scale + offset, media_rate);
+        }
+    };
+
+    /// A transition over [start, end) in one track, with the items either
+    /// side of it.  The entries of those items are not changed by it.
+    struct TransitionEntry
+    {
+        double            start;
+        double            end;
+        size_t            track_index;
+        Transition const* transition;
+        Item const*       outgoing;
+        Item const*       incoming;
+    };
+
+    /// The rate of the times in the schedule.
+    double rate() const noexcept { return _rate; }
+
+    /// The range of the timeline, in global time.
+    TimeRange range() const noexcept { return _range; }
+
+    size_t track_count() const noexcept { return _track_entries.size(); }
+
+    /// Every entry, in increasing order of start time, and for entries
+    /// that start together, of track index.
+    std::vector<Entry> const& entries() const noexcept { return _entries; }
+
+    /// Every transition, in the same order as the entries.
+    std::vector<TransitionEntry> const& transitions() const noexcept
+    {
+        return _transitions;
+    }
+
+    /// The entry visible in a track at a time, or null if there is none.
+    Entry const* entry_at(size_t track_index, double time) const noexcept;
+
+    Entry const*
+    entry_at(size_t track_index, RationalTime time) const noexcept
+    {
+        return entry_at(track_index, time.value_rescaled_to(_rate));
+    }
+
+    /// The entries visible at a time, one at most per track, in increasing
+    /// order of track index.  The results are put in entries, which is
+    /// cleared first, so that playing a run of times need not allocate.
+    void entries_at(
+        RationalTime               time,
+        std::vector<Entry const*>& entries) const;
+
+    /// The index in entries() of the first entry that ends after a time,
+    /// from which to play forward by iterating over entries().
+    size_t first_entry_after(RationalTime time) const noexcept;
+
+private:
+    friend class PlaybackScheduleCompiler;
+
+    PlaybackSchedule() = default;
+
+    double                           _rate = 1;
+    TimeRange                        _range;
+    std::vector<Entry>               _entries;
+    std::vector<TransitionEntry>     _transitions;
+    std::vector<std::vector<size_t>> _track_entries;
+    std::vector<std::vector<double>> _track_starts;
+    std::vector<double>              _entry_ends;
+};
+
+/**
+ * Makes the PlaybackSchedule of a timeline, and makes it again when the
+ * timeline changes.
+ *
+ * The tables of each track come from a MediaTimeEvaluator, so the same
+ * rules about nesting, stacking and time effects apply, and after an edit
+ * only the tracks that were edited are compiled again; the schedule is
+ * then put back together from the tables of every track.  The edits that
+ * are seen are those the MediaTimeEvaluator sees, plus a change of the
+ * timeline's global start time; call invalidate() after others.
+ *
+ * The compiler retains the timeline and is not safe to use from several
+ * threads at once, but the schedules it returns are.
+ */
+class PlaybackScheduleCompiler
+{
+public:
+    PlaybackScheduleCompiler(Timeline const* timeline);
+
+    Timeline const* timeline() const noexcept
+    {
+        return _evaluator.timeline();
+    }
+
+    /// The schedule for the timeline as it is now, compiling it first if
+    /// need be.  Returns the same schedule until the timeline changes.
+    std::shared_ptr<PlaybackSchedule const>
+    schedule(ErrorStatus* error_status = nullptr);
+
+    /// Whether the last schedule is up to date with the timeline.
+    bool is_current() const noexcept;
+
+    /// Force the schedule to be compiled again the next time it is asked
+    /// for.
+    void invalidate() noexcept
+    {
+        _schedule.reset();
+        _evaluator.invalidate();
+    }
+
+private:
+    bool _compile(ErrorStatus* error_status);
+
+    MediaTimeEvaluator                      _evaluator;
+    std::optional<RationalTime>             _global_start_time;
+    std::shared_ptr<PlaybackSchedule const> _schedule;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
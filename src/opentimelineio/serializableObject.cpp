@@ -40,21 +40,24 @@ SerializableObject::Reader::fwd_type_name_for_error_message(
 TypeRegistry::_TypeRecord const*
 SerializableObject::_type_record() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_cached_type_record)
+    // Objects made by the registry have their record from the start; the
+    // rest look it up on first use.  Two threads may both look it up, but
+    // they find the same record, so either store is fine.
+    auto record = _cached_type_record.load(std::memory_order_acquire);
+    if (!record)
     {
-        _cached_type_record =
-            TypeRegistry::instance()._lookup_type_record(typeid(*this));
-        if (!_cached_type_record)
+        record = TypeRegistry::instance()._lookup_type_record(typeid(*this));
+        if (!record)
         {
             fatal_error(string_printf(
                 "Code for C++ type %s has not been registered via "
                 "TypeRegistry::register_type<T>()",
                 type_name_for_error_message(typeid(*this)).c_str()));
         }
+        _cached_type_record.store(record, std::memory_order_release);
     }
 
-    return _cached_type_record;
+    return record;
 }
 
 bool
@@ -143,11 +146,16 @@ SerializableObject::to_json_file(
 SerializableObject*
 SerializableObject::from_json_string(
     std::string const& input,
-    ErrorStatus*       error_status)
+    ErrorStatus*       error_status,
+    bool               lazy_metadata)
 {
     std::any dest;
 
-    if (!deserialize_json_from_string(input, &dest, error_status))
+    if (!deserialize_json_from_string(
+            input,
+            &dest,
+            error_status,
+            lazy_metadata))
     {
         return nullptr;
     }
@@ -171,11 +179,16 @@ SerializableObject::from_json_string(
 SerializableObject*
 SerializableObject::from_json_file(
     std::string const& file_name,
-    ErrorStatus*       error_status)
+    ErrorStatus*       error_status,
+    bool               lazy_metadata)
 {
     std::any dest;
 
-    if (!deserialize_json_from_file(file_name, &dest, error_status))
+    if (!deserialize_json_from_file(
+            file_name,
+            &dest,
+            error_status,
+            lazy_metadata))
     {
         return nullptr;
     }
@@ -22,6 +22,7 @@
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
 class CloningEncoder;
+class ParallelJSONWriter;
 
 class SerializableObject
 {
@@ -56,12 +57,16 @@ public:
         const schema_version_map* target_family_label_spec = nullptr,
         int                       indent                   = 4) const;
 
+    /// Read an object from JSON; with lazy_metadata, metadata is kept as
+    /// JSON until it is used, as by deserialize_json_from_string().
     static SerializableObject* from_json_file(
         std::string const& file_name,
-        ErrorStatus*       error_status = nullptr);
+        ErrorStatus*       error_status  = nullptr,
+        bool               lazy_metadata = false);
     static SerializableObject* from_json_string(
         std::string const& input,
-        ErrorStatus*       error_status = nullptr);
+        ErrorStatus*       error_status  = nullptr,
+        bool               lazy_metadata = false);
 
     bool is_equivalent_to(SerializableObject const& other) const;
 
@@ -396,10 +401,15 @@ public:
         SerializableObject*     _source;
         int                     _line_number;
 
+        // Parse a value kept as JSON by a lazy read, for readers other than
+        // SerializableObjectWithMetadata, which keeps it as it is.
+        static void _parse_raw_json(std::any& value);
+
         friend class UnknownSchema;
         friend class JSONDecoder;
         friend class CloningEncoder;
         friend class SerializableObject;
+        friend class SerializableObjectWithMetadata;
         friend class TypeRegistry;
     };
 
@@ -435,6 +445,11 @@ public:
         void write(std::string const& key, AnyVector const& value);
         void write(std::string const& key, std::any const& value);
 
+        /// Write a value given as JSON, such as metadata kept as JSON by a
+        /// lazy read, without parsing it into a value if the encoder is
+        /// writing JSON.
+        void write_json(std::string const& key, std::string const& json);
+
         template <typename T>
         void write(std::string const& key, T const& value)
         {
@@ -525,17 +540,13 @@ public:
             const schema_version_map* downgrade_version_manifest)
             : _encoder(encoder)
             , _downgrade_version_manifest(downgrade_version_manifest)
-
-        {
-            _build_dispatch_tables();
-        }
+        {}
 
         ~Writer();
 
         Writer(Writer const&)           = delete;
         Writer operator=(Writer const&) = delete;
 
-        void _build_dispatch_tables();
         void _write(std::string const& key, std::any const& value);
         void _encoder_write_key(std::string const& key);
 
@@ -544,17 +555,6 @@ public:
         bool _any_equals(std::any const& lhs, std::any const& rhs);
 
         std::string _no_key;
-        std::unordered_map<
-            std::type_info const*,
-            std::function<void(std::any const&)>>
-            _write_dispatch_table;
-        std::unordered_map<
-            std::type_info const*,
-            std::function<bool(std::any const&, std::any const&)>>
-            _equality_dispatch_table;
-
-        std::unordered_map<std::string, std::function<void(std::any const&)>>
-            _write_dispatch_table_by_name;
         std::unordered_map<SerializableObject const*, std::string>
                                              _id_for_object;
         std::unordered_map<std::string, int> _next_id_for_type;
@@ -562,9 +562,14 @@ public:
         Writer*         _child_writer          = nullptr;
         CloningEncoder* _child_cloning_encoder = nullptr;
 
+        // Objects already encoded on other threads, to be copied into the
+        // output rather than written again.
+        ParallelJSONWriter const* _parallel = nullptr;
+
         class Encoder&            _encoder;
         const schema_version_map* _downgrade_version_manifest;
         friend class SerializableObject;
+        friend class ParallelJSONWriter;
     };
 
     virtual bool read_from(Reader&);
@@ -655,6 +660,13 @@ public:
         }
     };
 
+    /// A value kept as JSON by a lazy read, in place of the value itself;
+    /// see deserialize_json_from_string().
+    struct RawJSON
+    {
+        std::string json;
+    };
+
     void install_external_keepalive_monitor(
         std::function<void()> monitor,
         bool                  apply_now);
@@ -669,14 +681,16 @@ public:
 private:
     void _set_type_record(TypeRegistry::_TypeRecord const* type_record)
     {
-        _cached_type_record = type_record;
+        _cached_type_record.store(type_record, std::memory_order_release);
     }
 
     TypeRegistry::_TypeRecord const* _type_record() const;
 
-    mutable TypeRegistry::_TypeRecord const* _cached_type_record;
-    int                                      _managed_ref_count;
-    std::function<void()>                    _external_keepalive_monitor;
+    // Looked up at most once per object, and never changed afterwards
+    // other than to the same record, so it can be read without a lock.
+    mutable std::atomic<TypeRegistry::_TypeRecord const*> _cached_type_record;
+    int                                                   _managed_ref_count;
+    std::function<void()> _external_keepalive_monitor;
 
     mutable std::mutex _mutex;
 
@@ -2,9 +2,22 @@
 // Copyright Contributors to the OpenTimelineIO project
 
 #include "opentimelineio/serializableObjectWithMetadata.h"
+#include "opentimelineio/deserialization.h"
+
+#include <mutex>
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+struct SerializableObjectWithMetadata::_MetadataJSON
+{
+    _MetadataJSON(std::string&& text)
+        : json(std::move(text))
+    {}
+
+    std::string const json;
+    std::once_flag    parsed;
+};
+
 SerializableObjectWithMetadata::SerializableObjectWithMetadata(
     std::string const&   name,
     AnyDictionary const& metadata)
@@ -15,11 +28,51 @@ SerializableObjectWithMetadata::SerializableObjectWithMetadata(
 SerializableObjectWithMetadata::~SerializableObjectWithMetadata()
 {}
 
+void
+SerializableObjectWithMetadata::_take_metadata_json() noexcept
+{
+    _parse_metadata_json();
+    _metadata_json.reset();
+}
+
+void
+SerializableObjectWithMetadata::_parse_metadata_json() const noexcept
+{
+    std::call_once(_metadata_json->parsed, [this] {
+        // The JSON was written by a reader, so it should parse to a
+        // dictionary; if it somehow does not, the metadata is left empty
+        // rather than throwing out of a noexcept accessor.
+        std::any value;
+        if (!deserialize_json_from_string(_metadata_json->json, &value))
+        {
+            return;
+        }
+        if (auto dictionary = std::any_cast<AnyDictionary>(&value))
+        {
+            _metadata = std::move(*dictionary);
+        }
+    });
+}
+
 bool
 SerializableObjectWithMetadata::read_from(Reader& reader)
 {
-    return reader.read_if_present("metadata", &_metadata)
-           && reader.read_if_present("name", &_name)
+    _metadata_json.reset();
+
+    auto e = reader._dict.find("metadata");
+    if (e != reader._dict.end() && e->second.type() == typeid(RawJSON))
+    {
+        _metadata.clear();
+        _metadata_json.reset(new _MetadataJSON(
+            std::move(std::any_cast<RawJSON&>(e->second).json)));
+        reader._dict.erase(e);
+    }
+    else if (!reader.read_if_present("metadata", &_metadata))
+    {
+        return false;
+    }
+
+    return reader.read_if_present("name", &_name)
            && SerializableObject::read_from(reader);
 }
 
@@ -27,7 +80,14 @@ void
 SerializableObjectWithMetadata::write_to(Writer& writer) const
 {
     SerializableObject::write_to(writer);
-    writer.write("metadata", _metadata);
+    if (_metadata_json)
+    {
+        writer.write_json("metadata", _metadata_json->json);
+    }
+    else
+    {
+        writer.write("metadata", _metadata);
+    }
     writer.write("name", _name);
 }
 
@@ -6,6 +6,8 @@
 #include "opentimelineio/serializableObject.h"
 #include "opentimelineio/version.h"
 
+#include <memory>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
 class SerializableObjectWithMetadata : public SerializableObject
@@ -27,9 +29,23 @@ public:
 
     void set_name(std::string const& name) { _name = name; }
 
-    AnyDictionary& metadata() noexcept { return _metadata; }
+    AnyDictionary& metadata() noexcept
+    {
+        if (_metadata_json)
+        {
+            _take_metadata_json();
+        }
+        return _metadata;
+    }
 
-    AnyDictionary metadata() const noexcept { return _metadata; }
+    AnyDictionary metadata() const noexcept
+    {
+        if (_metadata_json)
+        {
+            _parse_metadata_json();
+        }
+        return _metadata;
+    }
 
 protected:
     virtual ~SerializableObjectWithMetadata();
@@ -38,8 +54,18 @@ protected:
     void write_to(Writer&) const override;
 
 private:
-    std::string   _name;
-    AnyDictionary _metadata;
+    // Metadata kept as JSON by a lazy read, until it is used.  Reading it
+    // through a const object parses it but keeps the JSON, which is written
+    // out in place of the metadata until it is reached through a non-const
+    // object, and so may have changed.
+    struct _MetadataJSON;
+
+    void _take_metadata_json() noexcept;
+    void _parse_metadata_json() const noexcept;
+
+    std::string                    _name;
+    mutable AnyDictionary          _metadata;
+    std::unique_ptr<_MetadataJSON> _metadata_json;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
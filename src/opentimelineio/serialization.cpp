@@ -4,15 +4,32 @@
 #include "opentimelineio/serialization.h"
 #include "errorStatus.h"
 #include "opentimelineio/anyDictionary.h"
+#include "opentimelineio/anyKind.h"
+#include "opentimelineio/deserialization.h"
+#include "opentimelineio/serializableCollection.h"
 #include "opentimelineio/serializableObject.h"
+#include "opentimelineio/stack.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/typeRegistry.h"
 #include "opentimelineio/unknownSchema.h"
+#include "parallelFor.h"
 #include "stringUtils.h"
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #define RAPIDJSON_NAMESPACE OTIO_rapidjson
+#include <rapidjson/cursorstreamwrapper.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/filereadstream.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
@@ -78,6 +95,22 @@ public:
     virtual void write_value(struct SerializableObject::ReferenceId) = 0;
     virtual void write_value(IMATH_NAMESPACE::Box2d const&)          = 0;
 
+    /// Copy JSON from an encoder of the same kind into the output as the
+    /// next value, if the encoder can, and the JSON was indented for the
+    /// number of objects and arrays that are open; see ParallelJSONWriter.
+    virtual bool
+    write_raw_value(std::string const& /* json */, size_t /* level */)
+    {
+        return false;
+    }
+
+    /// Write a value given as JSON, if the encoder can without parsing it
+    /// into a value; see SerializableObject::Writer::write_json().
+    virtual bool write_json_value(std::string const& /* json */)
+    {
+        return false;
+    }
+
 protected:
     void _error(ErrorStatus const& error_status)
     {
@@ -121,6 +154,18 @@ public:
         return (_result_object_policy == ResultObjectPolicy::OnlyAnyDictionary);
     }
 
+    // A clone keeps the JSON, so that it is parsed only if it is used.
+    bool write_json_value(std::string const& json) override
+    {
+        if (_result_object_policy
+            != ResultObjectPolicy::CloneBackToSerializableObject)
+        {
+            return false;
+        }
+        _store(std::any(SerializableObject::RawJSON{ json }));
+        return true;
+    }
+
     void write_key(std::string const& key) override
     {
         if (has_errored())
@@ -623,141 +668,593 @@ public:
         _writer.EndObject();
     }
 
-    void start_array(size_t) { _writer.StartArray(); }
+    void start_array(size_t)
+    {
+        _writer.StartArray();
+        ++_level;
+    }
 
-    void start_object() { _writer.StartObject(); }
+    void start_object()
+    {
+        _writer.StartObject();
+        ++_level;
+    }
 
-    void end_array() { _writer.EndArray(); }
+    void end_array()
+    {
+        _writer.EndArray();
+        --_level;
+    }
 
-    void end_object() { _writer.EndObject(); }
+    void end_object()
+    {
+        _writer.EndObject();
+        --_level;
+    }
+
+    bool write_raw_value(std::string const& json, size_t level) override
+    {
+        if (level != _level)
+        {
+            return false;
+        }
+        _writer.RawValue(
+            json.c_str(),
+            json.size(),
+            OTIO_rapidjson::kObjectType);
+        return true;
+    }
+
+    // The writer is a SAX handler, so the JSON is copied through it, and
+    // indented as it would be if it had been written value by value.
+    bool write_json_value(std::string const& json) override
+    {
+        OTIO_rapidjson::Reader       reader;
+        OTIO_rapidjson::StringStream ss(json.c_str());
+        bool status =
+            reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(ss, _writer);
+        return status;
+    }
 
 private:
     RapidJSONWriterType& _writer;
+    size_t               _level = 0;
 };
 
-template <typename T>
-bool
-_simple_any_comparison(std::any const& lhs, std::any const& rhs)
+/**
+ * Writes a value with the children of each Stack and SerializableCollection
+ * in it encoded beforehand on several threads, each into its own buffer.
+ *
+ * The children are found by walking down from the value through
+ * collections, timelines and stacks, without going into tracks, so for a
+ * timeline they are its tracks and for a collection of timelines, the
+ * tracks of each.  Each is encoded by a Writer of its own, exactly as it
+ * would be in place, and then indented for the level it will be at in the
+ * output, so that the Writer of the whole value only has to copy it.  A
+ * child that fails to encode, or that turns up at another level, is just
+ * written in place, so errors are reported as they would have been.
+ */
+class ParallelJSONWriter
 {
-    return lhs.type() == typeid(T) && rhs.type() == typeid(T)
-           && std::any_cast<T const&>(lhs) == std::any_cast<T const&>(rhs);
-}
+public:
+    ParallelJSONWriter(
+        std::any const&           value,
+        const schema_version_map* schema_version_targets,
+        bool                      pretty,
+        int                       indent)
+        : _value(value)
+        , _schema_version_targets(schema_version_targets)
+        , _pretty(pretty)
+        , _indent(pretty ? size_t(std::max(indent, 0)) : 0)
+    {
+        if (auto root = std::any_cast<SerializableObject::Retainer<>>(&value))
+        {
+            _collect(root->value, 0);
+        }
+    }
 
-template <>
-bool
-_simple_any_comparison<void>(std::any const& lhs, std::any const& rhs)
-{
-    return lhs.type() == typeid(void) && rhs.type() == typeid(void);
-}
+    /// Encode the children on up to thread_count threads.  Returns false,
+    /// without encoding anything, if there would be nothing to gain.
+    bool encode(int thread_count)
+    {
+        size_t const threads =
+            parallel_thread_count(thread_count, _fragments.size());
+        if (threads < 2)
+        {
+            return false;
+        }
 
-template <>
-bool
-_simple_any_comparison<char const*>(std::any const& lhs, std::any const& rhs)
+        parallel_for(_fragments.size(), threads, [&](size_t i) {
+            _encode(_fragments[i]);
+        });
+        return true;
+    }
+
+    /// Write the value as SerializableObject::Writer::write_root() does.
+    bool write_root(Encoder& encoder, ErrorStatus* error_status) const
+    {
+        SerializableObject::Writer w(encoder, _schema_version_targets);
+        w._parallel = this;
+        w.write(w._no_key, _value);
+        return !encoder.has_errored(error_status);
+    }
+
+    /// Copy the JSON of an object into the output, if it was encoded.
+    bool splice(SerializableObject const* object, Encoder& encoder) const
+    {
+        auto const found = _indices.find(object);
+        if (found == _indices.end())
+        {
+            return false;
+        }
+        Fragment const& fragment = _fragments[found->second];
+        return fragment.encoded
+               && encoder.write_raw_value(fragment.json, fragment.level);
+    }
+
+private:
+    struct Fragment
+    {
+        SerializableObject const* object;
+        size_t                    level;
+        std::string               json;
+        bool                      encoded = false;
+    };
+
+    // level is the number of objects and arrays open around the object.
+    void _collect(SerializableObject const* object, size_t level)
+    {
+        if (auto timeline = dynamic_cast<Timeline const*>(object))
+        {
+            _collect(timeline->tracks(), level + 1);
+            return;
+        }
+
+        // The children are in an array in the object.
+        if (auto collection =
+                dynamic_cast<SerializableCollection const*>(object))
+        {
+            for (auto const& child: collection->children())
+            {
+                if (dynamic_cast<SerializableCollection const*>(child.value)
+                    || dynamic_cast<Timeline const*>(child.value)
+                    || dynamic_cast<Stack const*>(child.value))
+                {
+                    _collect(child, level + 2);
+                }
+                else
+                {
+                    _add(child, level + 2);
+                }
+            }
+        }
+        else if (auto stack = dynamic_cast<Stack const*>(object))
+        {
+            for (auto const& child: stack->children())
+            {
+                _add(child, level + 2);
+            }
+        }
+    }
+
+    void _add(SerializableObject const* object, size_t level)
+    {
+        if (object && _indices.emplace(object, _fragments.size()).second)
+        {
+            _fragments.push_back(
+                Fragment{ object, level, std::string(), false });
+        }
+    }
+
+    void _encode(Fragment& fragment) const
+    {
+        OTIO_rapidjson::StringBuffer buffer;
+        if (_pretty)
+        {
+            OTIO_rapidjson::PrettyWriter<
+                decltype(buffer),
+                OTIO_rapidjson::UTF8<>,
+                OTIO_rapidjson::UTF8<>,
+                OTIO_rapidjson::CrtAllocator,
+                OTIO_rapidjson::kWriteNanAndInfFlag>
+                json_writer(buffer);
+            json_writer.SetIndent(' ', unsigned(_indent));
+            fragment.encoded = _encode_with(json_writer, fragment.object);
+        }
+        else
+        {
+            OTIO_rapidjson::Writer<
+                decltype(buffer),
+                OTIO_rapidjson::UTF8<>,
+                OTIO_rapidjson::UTF8<>,
+                OTIO_rapidjson::CrtAllocator,
+                OTIO_rapidjson::kWriteNanAndInfFlag>
+                json_writer(buffer);
+            fragment.encoded = _encode_with(json_writer, fragment.object);
+        }
+        if (fragment.encoded)
+        {
+            _indent_lines(
+                buffer.GetString(),
+                buffer.GetSize(),
+                fragment.level * _indent,
+                fragment.json);
+        }
+    }
+
+    template <typename RapidJSONWriterType>
+    bool _encode_with(
+        RapidJSONWriterType&      json_writer,
+        SerializableObject const* object) const
+    {
+        JSONEncoder<RapidJSONWriterType> encoder(json_writer);
+        SerializableObject::Writer       w(encoder, _schema_version_targets);
+        w.write(w._no_key, object);
+        return !encoder.has_errored();
+    }
+
+    // Every newline in the JSON is one the writer put in for layout, since
+    // those in strings are escaped.
+    static void _indent_lines(
+        char const*  json,
+        size_t       size,
+        size_t       width,
+        std::string& result)
+    {
+        char const* const end = json + size;
+        result.reserve(size);
+        while (width > 0)
+        {
+            auto newline =
+                static_cast<char const*>(std::memchr(json, '\n', end - json));
+            if (!newline)
+            {
+                break;
+            }
+            result.append(json, newline + 1);
+            result.append(width, ' ');
+            json = newline + 1;
+        }
+        result.append(json, end);
+    }
+
+    std::any const&           _value;
+    const schema_version_map* _schema_version_targets;
+    bool                      _pretty;
+    size_t                    _indent;
+    std::vector<Fragment>     _fragments;
+
+    // The index in _fragments of each object.
+    std::unordered_map<SerializableObject const*, size_t> _indices;
+};
+
+/**
+ * The version each registered schema is written at, given a map of schema
+ * version targets, for SchemaVersionConverter.
+ */
+class SchemaVersionTargets
 {
-    return lhs.type() == typeid(char const*)
-           && rhs.type() == typeid(char const*)
-           && !strcmp(
-               std::any_cast<char const*>(lhs),
-               std::any_cast<char const*>(rhs));
-}
+public:
+    SchemaVersionTargets(const schema_version_map* schema_version_targets)
+    {
+        auto&                       registry = TypeRegistry::instance();
+        std::lock_guard<std::mutex> lock(registry._registry_mutex);
+        for (auto const& e: registry._type_records)
+        {
+            // Objects read with another name are written with the name of
+            // their type, so they are never written as they were read.
+            int64_t version = -1;
+            if (e.first == e.second->schema_name)
+            {
+                version = e.second->schema_version;
+                if (schema_version_targets)
+                {
+                    auto const target = schema_version_targets->find(e.first);
+                    if (target != schema_version_targets->end())
+                    {
+                        version = std::min(version, target->second);
+                    }
+                }
+            }
+            _versions.emplace(e.first, version);
+        }
+    }
 
-void
-SerializableObject::Writer::_build_dispatch_tables()
+    /// Whether an object with a schema such as "Clip.2" would be written
+    /// with the same schema, and so can be copied as it is: its schema is
+    /// at its target version, or is not registered.
+    bool is_target(std::string const& schema) const
+    {
+        auto const separator = schema.rfind('.');
+        if (separator == std::string::npos || separator + 1 == schema.size())
+        {
+            return false;
+        }
+
+        int64_t version = 0;
+        for (size_t i = separator + 1; i < schema.size(); ++i)
+        {
+            if (schema[i] < '0' || schema[i] > '9' || version > 0xFFFFFF)
+            {
+                return false;
+            }
+            version = version * 10 + (schema[i] - '0');
+        }
+
+        auto const found = _versions.find(schema.substr(0, separator));
+        return found == _versions.end() || found->second == version;
+    }
+
+private:
+    std::unordered_map<std::string, int64_t> _versions;
+};
+
+/**
+ * A rapidjson reader handler that copies OTIO JSON to a writer, converting
+ * each object to the version it is written at with a map of schema version
+ * targets, for convert_json_string() and convert_json_file().
+ *
+ * An object whose schema is already its target is copied as it is read, a
+ * value at a time, and the objects in it are converted as they come.  Any
+ * other object is captured as JSON, read, and written with the targets as
+ * serialize_json_to_string() would write it, so only those objects are ever
+ * in memory.
+ *
+ * Objects are recognized by an OTIO_SCHEMA key at their start, which is
+ * where OTIO writes it.  If one turns up anywhere else, the handler stops,
+ * and needs_full_conversion() is true.
+ */
+template <typename RapidJSONWriterType>
+class SchemaVersionConverter
+    : public OTIO_rapidjson::BaseReaderHandler<
+          OTIO_rapidjson::UTF8<>,
+          SchemaVersionConverter<RapidJSONWriterType>>
 {
-    /*
-     * These are basically atomic writes to the encoder:
-     */
+public:
+    SchemaVersionConverter(
+        RapidJSONWriterType&      writer,
+        const schema_version_map* schema_version_targets)
+        : _writer(writer)
+        , _schema_version_targets(schema_version_targets)
+        , _targets(schema_version_targets)
+    {}
 
-    auto& wt          = _write_dispatch_table;
-    wt[&typeid(void)] = [this](std::any const&) {
-        _encoder.write_null_value();
-    };
-    wt[&typeid(bool)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<bool>(value));
-    };
-    wt[&typeid(int64_t)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<int64_t>(value));
-    };
-    wt[&typeid(double)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<double>(value));
-    };
-    wt[&typeid(std::string)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<std::string const&>(value));
-    };
-    wt[&typeid(char const*)] = [this](std::any const& value) {
-        _encoder.write_value(std::string(std::any_cast<char const*>(value)));
-    };
-    wt[&typeid(RationalTime)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<RationalTime const&>(value));
-    };
-    wt[&typeid(TimeRange)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<TimeRange const&>(value));
-    };
-    wt[&typeid(TimeTransform)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<TimeTransform const&>(value));
-    };
-    wt[&typeid(IMATH_NAMESPACE::V2d)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<IMATH_NAMESPACE::V2d const&>(value));
-    };
-    wt[&typeid(IMATH_NAMESPACE::Box2d)] = [this](std::any const& value) {
-        _encoder.write_value(
-            std::any_cast<IMATH_NAMESPACE::Box2d const&>(value));
-    };
+    bool has_errored(ErrorStatus* error_status) const
+    {
+        if (error_status)
+        {
+            *error_status = _error_status;
+        }
+        return is_error(_error_status);
+    }
 
-    /*
-     * These next recurse back through the Writer itself:
-     */
-    wt[&typeid(SerializableObject::Retainer<>)] =
-        [this](std::any const& value) {
-            this->write(
-                _no_key,
-                std::any_cast<SerializableObject::Retainer<>>(value));
-        };
+    bool needs_full_conversion() const { return _full_conversion; }
 
-    wt[&typeid(AnyDictionary)] = [this](std::any const& value) {
-        this->write(_no_key, std::any_cast<AnyDictionary const&>(value));
-    };
+    bool Null()
+    {
+        return _value([](auto& writer) { writer.Null(); });
+    }
 
-    wt[&typeid(AnyVector)] = [this](std::any const& value) {
-        this->write(_no_key, std::any_cast<AnyVector const&>(value));
-    };
+    bool Bool(bool b)
+    {
+        return _value([b](auto& writer) { writer.Bool(b); });
+    }
 
-    /*
-     * Install a backup table, using the actual type name as a key.
-     * This is to deal with type aliasing across compilation units.
-     */
-    for (const auto& e: wt)
-    {
-        _write_dispatch_table_by_name[e.first->name()] = e.second;
-    }
-
-    auto& et                   = _equality_dispatch_table;
-    et[&typeid(void)]          = &_simple_any_comparison<void>;
-    et[&typeid(bool)]          = &_simple_any_comparison<bool>;
-    et[&typeid(int64_t)]       = &_simple_any_comparison<int64_t>;
-    et[&typeid(double)]        = &_simple_any_comparison<double>;
-    et[&typeid(std::string)]   = &_simple_any_comparison<std::string>;
-    et[&typeid(char const*)]   = &_simple_any_comparison<char const*>;
-    et[&typeid(RationalTime)]  = &_simple_any_comparison<RationalTime>;
-    et[&typeid(TimeRange)]     = &_simple_any_comparison<TimeRange>;
-    et[&typeid(TimeTransform)] = &_simple_any_comparison<TimeTransform>;
-    et[&typeid(SerializableObject::ReferenceId)] =
-        &_simple_any_comparison<SerializableObject::ReferenceId>;
-    et[&typeid(IMATH_NAMESPACE::V2d)] =
-        &_simple_any_comparison<IMATH_NAMESPACE::V2d>;
-    et[&typeid(IMATH_NAMESPACE::Box2d)] =
-        &_simple_any_comparison<IMATH_NAMESPACE::Box2d>;
-
-    /*
-     * These next recurse back through the Writer itself:
-     */
-    et[&typeid(AnyDictionary)] =
-        [this](std::any const& lhs, std::any const& rhs) {
-            return _any_dict_equals(lhs, rhs);
-        };
-    et[&typeid(AnyVector)] = [this](std::any const& lhs, std::any const& rhs) {
-        return _any_array_equals(lhs, rhs);
-    };
+    // Integers are written as int64_t, as they are when read into objects.
+    bool Int(int i) { return Int64(i); }
+
+    bool Uint(unsigned u) { return Int64(u); }
+
+    bool Uint64(uint64_t u) { return Int64(int64_t(u & 0x7FFFFFFFFFFFFFFF)); }
+
+    bool Int64(int64_t i)
+    {
+        return _value([i](auto& writer) { writer.Int64(i); });
+    }
+
+    bool Double(double d)
+    {
+        return _value([d](auto& writer) { writer.Double(d); });
+    }
+
+    bool String(const char* str, OTIO_rapidjson::SizeType length, bool)
+    {
+        if (_schema_pending)
+        {
+            _schema_pending = false;
+            return _start_object(std::string(str, length));
+        }
+        return _value([=](auto& writer) { writer.String(str, length); });
+    }
+
+    bool Key(const char* str, OTIO_rapidjson::SizeType length, bool)
+    {
+        if (_capture)
+        {
+            _capture->Key(str, length);
+            return true;
+        }
+
+        bool const is_schema = std::string(str, length) == "OTIO_SCHEMA";
+        if (_object_pending)
+        {
+            _object_pending = false;
+            if (is_schema)
+            {
+                _schema_pending = true;
+                return true;
+            }
+            _writer.StartObject();
+        }
+        else if (is_schema)
+        {
+            _full_conversion = true;
+            return false;
+        }
+        _writer.Key(str, length);
+        return true;
+    }
+
+    bool StartObject()
+    {
+        if (_capture)
+        {
+            ++_capture_depth;
+            _capture->StartObject();
+            return true;
+        }
+        if (_schema_pending)
+        {
+            _full_conversion = true;
+            return false;
+        }
+        _object_pending = true;
+        return true;
+    }
+
+    bool EndObject(OTIO_rapidjson::SizeType)
+    {
+        if (_capture)
+        {
+            _capture->EndObject();
+            return --_capture_depth > 0 || _write_capture();
+        }
+        if (_object_pending)
+        {
+            _object_pending = false;
+            _writer.StartObject();
+        }
+        _writer.EndObject();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (_capture)
+        {
+            ++_capture_depth;
+            _capture->StartArray();
+            return true;
+        }
+        if (_schema_pending)
+        {
+            _full_conversion = true;
+            return false;
+        }
+        _writer.StartArray();
+        return true;
+    }
+
+    bool EndArray(OTIO_rapidjson::SizeType)
+    {
+        if (_capture)
+        {
+            --_capture_depth;
+            _capture->EndArray();
+        }
+        else
+        {
+            _writer.EndArray();
+        }
+        return true;
+    }
+
+private:
+    using CaptureWriterType = OTIO_rapidjson::Writer<
+        OTIO_rapidjson::StringBuffer,
+        OTIO_rapidjson::UTF8<>,
+        OTIO_rapidjson::UTF8<>,
+        OTIO_rapidjson::CrtAllocator,
+        OTIO_rapidjson::kWriteNanAndInfFlag>;
+
+    template <typename Write>
+    bool _value(Write&& write)
+    {
+        if (_capture)
+        {
+            write(*_capture);
+        }
+        else if (_schema_pending)
+        {
+            // OTIO_SCHEMA is not a string, which reading will report.
+            _full_conversion = true;
+            return false;
+        }
+        else
+        {
+            write(_writer);
+        }
+        return true;
+    }
+
+    // Start an object once its schema is known.
+    bool _start_object(std::string const& schema)
+    {
+        if (_targets.is_target(schema))
+        {
+            _writer.StartObject();
+            _writer.Key("OTIO_SCHEMA");
+            _writer.String(
+                schema.c_str(),
+                OTIO_rapidjson::SizeType(schema.size()));
+            return true;
+        }
+
+        _capture_buffer.Clear();
+        _capture.reset(new CaptureWriterType(_capture_buffer));
+        _capture_depth = 1;
+        _capture->StartObject();
+        _capture->Key("OTIO_SCHEMA");
+        _capture->String(
+            schema.c_str(),
+            OTIO_rapidjson::SizeType(schema.size()));
+        return true;
+    }
+
+    // Read the captured object and write it converted.
+    bool _write_capture()
+    {
+        _capture.reset();
+
+        std::any value;
+        if (!deserialize_json_from_buffer(
+                _capture_buffer.GetString(),
+                _capture_buffer.GetSize(),
+                &value,
+                &_error_status))
+        {
+            return false;
+        }
+
+        JSONEncoder<RapidJSONWriterType> encoder(_writer);
+        return SerializableObject::Writer::write_root(
+            value,
+            encoder,
+            _schema_version_targets,
+            &_error_status);
+    }
+
+    RapidJSONWriterType&      _writer;
+    const schema_version_map* _schema_version_targets;
+    SchemaVersionTargets      _targets;
+    ErrorStatus               _error_status;
+    bool                      _full_conversion = false;
+
+    // A StartObject() has been read but not written, since whether the
+    // object is copied depends on its OTIO_SCHEMA, if it has one.
+    bool _object_pending = false;
+    bool _schema_pending = false;
+
+    OTIO_rapidjson::StringBuffer       _capture_buffer;
+    std::unique_ptr<CaptureWriterType> _capture;
+    size_t                             _capture_depth = 0;
+};
+
+template <typename T>
+bool
+_simple_any_comparison(std::any const& lhs, std::any const& rhs)
+{
+    return std::any_cast<T const&>(lhs) == std::any_cast<T const&>(rhs);
 }
 
 bool
@@ -827,8 +1324,54 @@ SerializableObject::Writer::_any_equals(
     std::any const& lhs,
     std::any const& rhs)
 {
-    auto e = _equality_dispatch_table.find(&lhs.type());
-    return (e != _equality_dispatch_table.end()) && e->second(lhs, rhs);
+    AnyKind const kind = any_kind(lhs);
+    if (kind != any_kind(rhs))
+    {
+        return false;
+    }
+
+    switch (kind)
+    {
+        case AnyKind::null:
+            return true;
+        case AnyKind::boolean:
+            return _simple_any_comparison<bool>(lhs, rhs);
+        case AnyKind::int64:
+            return _simple_any_comparison<int64_t>(lhs, rhs);
+        case AnyKind::double_:
+            return _simple_any_comparison<double>(lhs, rhs);
+        case AnyKind::string:
+            return _simple_any_comparison<std::string>(lhs, rhs);
+        case AnyKind::c_string:
+            return !strcmp(
+                std::any_cast<char const*>(lhs),
+                std::any_cast<char const*>(rhs));
+        case AnyKind::rational_time:
+            return _simple_any_comparison<RationalTime>(lhs, rhs);
+        case AnyKind::time_range:
+            return _simple_any_comparison<TimeRange>(lhs, rhs);
+        case AnyKind::time_transform:
+            return _simple_any_comparison<TimeTransform>(lhs, rhs);
+        case AnyKind::v2d:
+            return _simple_any_comparison<IMATH_NAMESPACE::V2d>(lhs, rhs);
+        case AnyKind::box2d:
+            return _simple_any_comparison<IMATH_NAMESPACE::Box2d>(lhs, rhs);
+        case AnyKind::reference_id:
+            return _simple_any_comparison<SerializableObject::ReferenceId>(
+                lhs,
+                rhs);
+        /*
+         * These next recurse back through the Writer itself:
+         */
+        case AnyKind::dictionary:
+            return _any_dict_equals(lhs, rhs);
+        case AnyKind::vector:
+            return _any_array_equals(lhs, rhs);
+        case AnyKind::retainer:
+        case AnyKind::unknown:
+            break;
+    }
+    return false;
 }
 
 bool
@@ -942,6 +1485,11 @@ SerializableObject::Writer::write(
         return;
     }
 
+    if (_parallel && _parallel->splice(value, _encoder))
+    {
+        return;
+    }
+
     auto e = _id_for_object.find(value);
     if (e != _id_for_object.end())
     {
@@ -1128,6 +1676,28 @@ SerializableObject::Writer::write(
     _encoder.end_array();
 }
 
+void
+SerializableObject::Writer::write_json(
+    std::string const& key,
+    std::string const& json)
+{
+    _encoder_write_key(key);
+
+    if (_encoder.write_json_value(json))
+    {
+        return;
+    }
+
+    std::any    value;
+    ErrorStatus error_status;
+    if (!deserialize_json_from_string(json, &value, &error_status))
+    {
+        _encoder._error(error_status);
+        return;
+    }
+    write(_no_key, value);
+}
+
 void
 SerializableObject::Writer::write(std::string const& key, std::any const& value)
 {
@@ -1135,56 +1705,86 @@ SerializableObject::Writer::write(std::string const& key, std::any const& value)
 
     _encoder_write_key(key);
 
-    auto e = _write_dispatch_table.find(&type);
-    if (e == _write_dispatch_table.end())
+    switch (any_kind(type))
     {
+        case AnyKind::null:
+            _encoder.write_null_value();
+            return;
+        case AnyKind::boolean:
+            _encoder.write_value(std::any_cast<bool>(value));
+            return;
+        case AnyKind::int64:
+            _encoder.write_value(std::any_cast<int64_t>(value));
+            return;
+        case AnyKind::double_:
+            _encoder.write_value(std::any_cast<double>(value));
+            return;
+        case AnyKind::string:
+            _encoder.write_value(std::any_cast<std::string const&>(value));
+            return;
+        case AnyKind::c_string:
+            _encoder.write_value(
+                std::string(std::any_cast<char const*>(value)));
+            return;
+        case AnyKind::rational_time:
+            _encoder.write_value(std::any_cast<RationalTime const&>(value));
+            return;
+        case AnyKind::time_range:
+            _encoder.write_value(std::any_cast<TimeRange const&>(value));
+            return;
+        case AnyKind::time_transform:
+            _encoder.write_value(std::any_cast<TimeTransform const&>(value));
+            return;
+        case AnyKind::v2d:
+            _encoder.write_value(
+                std::any_cast<IMATH_NAMESPACE::V2d const&>(value));
+            return;
+        case AnyKind::box2d:
+            _encoder.write_value(
+                std::any_cast<IMATH_NAMESPACE::Box2d const&>(value));
+            return;
         /*
-         * Using the address of a type_info suffers from aliasing across
-         * compilation units. If we fail on a lookup, we fallback on the
-         * by_name table, but that's slow because we have to keep making a
-         * string each time.
-         *
-         * So when we fail, we insert the address of the type_info that failed
-         * to be found, so that we'll catch it the next time.  This ensures we
-         * fail exactly once per alias per type while using this writer.
+         * These next recurse back through the Writer itself:
          */
-        const auto& backup_e = _write_dispatch_table_by_name.find(type.name());
-        if (backup_e != _write_dispatch_table_by_name.end())
-        {
-            e = _write_dispatch_table.insert({ &type, backup_e->second }).first;
-        }
+        case AnyKind::retainer:
+            write(
+                _no_key,
+                std::any_cast<SerializableObject::Retainer<> const&>(value));
+            return;
+        case AnyKind::dictionary:
+            write(_no_key, std::any_cast<AnyDictionary const&>(value));
+            return;
+        case AnyKind::vector:
+            write(_no_key, std::any_cast<AnyVector const&>(value));
+            return;
+        case AnyKind::reference_id:
+        case AnyKind::unknown:
+            break;
     }
 
-    if (e != _write_dispatch_table.end())
+    std::string s;
+    std::string bad_type_name =
+        (type == typeid(UnknownType))
+            ? type_name_for_error_message(
+                  std::any_cast<UnknownType>(value).type_name)
+            : type_name_for_error_message(type);
+
+    if (&key != &_no_key)
     {
-        e->second(value);
+        s = string_printf(
+            "Encountered object of unknown type '%s' under key '%s'",
+            bad_type_name.c_str(),
+            key.c_str());
     }
     else
     {
-        std::string s;
-        std::string bad_type_name =
-            (type == typeid(UnknownType))
-                ? type_name_for_error_message(
-                      std::any_cast<UnknownType>(value).type_name)
-                : type_name_for_error_message(type);
-
-        if (&key != &_no_key)
-        {
-            s = string_printf(
-                "Encountered object of unknown type '%s' under key '%s'",
-                bad_type_name.c_str(),
-                key.c_str());
-        }
-        else
-        {
-            s = string_printf(
-                "Encountered object of unknown type '%s'",
-                bad_type_name.c_str());
-        }
-
-        _encoder._error(ErrorStatus(ErrorStatus::TYPE_MISMATCH, s));
-        _encoder.write_null_value();
+        s = string_printf(
+            "Encountered object of unknown type '%s'",
+            bad_type_name.c_str());
     }
+
+    _encoder._error(ErrorStatus(ErrorStatus::TYPE_MISMATCH, s));
+    _encoder.write_null_value();
 }
 
 bool
@@ -1239,13 +1839,100 @@ SerializableObject::clone(ErrorStatus* error_status) const
                : nullptr;
 }
 
+namespace {
+
+// Write a value with a JSONEncoder over a json_writer, which is a Writer, or
+// a PrettyWriter indented by indent spaces if indent is not negative.
+template <typename RapidJSONWriterType>
+bool
+write_json_root(
+    std::any const&           value,
+    RapidJSONWriterType&      json_writer,
+    const schema_version_map* schema_version_targets,
+    ErrorStatus*              error_status,
+    int                       thread_count,
+    int                       indent)
+{
+    JSONEncoder<RapidJSONWriterType> json_encoder(json_writer);
+
+    // Instancing names objects by the order they are written in, so
+    // fragments encoded on their own would not name them the same way.
+#ifndef OTIO_INSTANCING_SUPPORT
+    if (thread_count != 1)
+    {
+        ParallelJSONWriter parallel_writer(
+            value,
+            schema_version_targets,
+            indent >= 0,
+            indent);
+        if (parallel_writer.encode(thread_count))
+        {
+            return parallel_writer.write_root(json_encoder, error_status);
+        }
+    }
+#endif
+
+    return SerializableObject::Writer::write_root(
+        value,
+        json_encoder,
+        schema_version_targets,
+        error_status);
+}
+
+// Convert the JSON of a stream to a json_writer.  Returns false, setting
+// full_conversion, if it has to be read whole and serialized instead.
+template <typename InputStream, typename RapidJSONWriterType>
+bool
+convert_json(
+    InputStream&              input,
+    RapidJSONWriterType&      json_writer,
+    const schema_version_map* schema_version_targets,
+    bool*                     full_conversion,
+    ErrorStatus*              error_status)
+{
+    OTIO_rapidjson::Reader                                reader;
+    OTIO_rapidjson::CursorStreamWrapper<InputStream>      csw(input);
+    SchemaVersionConverter<RapidJSONWriterType> converter(
+        json_writer,
+        schema_version_targets);
+
+    bool const status =
+        reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(csw, converter);
+
+    *full_conversion = converter.needs_full_conversion();
+    if (*full_conversion || converter.has_errored(error_status))
+    {
+        return false;
+    }
+
+    if (!status)
+    {
+        if (error_status)
+        {
+            auto msg      = GetParseError_En(reader.GetParseErrorCode());
+            *error_status = ErrorStatus(
+                ErrorStatus::JSON_PARSE_ERROR,
+                string_printf(
+                    "JSON parse error on input: %s (line %d, column %d)",
+                    msg,
+                    csw.GetLine(),
+                    csw.GetColumn()));
+        }
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
 // to json_string
 std::string
 serialize_json_to_string_pretty(
     const std::any&           value,
     const schema_version_map* schema_version_targets,
     ErrorStatus*              error_status,
-    int                       indent)
+    int                       indent,
+    int                       thread_count)
 {
     OTIO_rapidjson::StringBuffer output_string_buffer;
 
@@ -1259,13 +1946,13 @@ serialize_json_to_string_pretty(
 
     json_writer.SetIndent(' ', indent);
 
-    JSONEncoder<decltype(json_writer)> json_encoder(json_writer);
-
-    if (!SerializableObject::Writer::write_root(
+    if (!write_json_root(
             value,
-            json_encoder,
+            json_writer,
             schema_version_targets,
-            error_status))
+            error_status,
+            thread_count,
+            indent))
     {
         return std::string();
     }
@@ -1278,7 +1965,8 @@ std::string
 serialize_json_to_string_compact(
     const std::any&           value,
     const schema_version_map* schema_version_targets,
-    ErrorStatus*              error_status)
+    ErrorStatus*              error_status,
+    int                       thread_count)
 {
     OTIO_rapidjson::StringBuffer output_string_buffer;
 
@@ -1290,13 +1978,13 @@ serialize_json_to_string_compact(
         OTIO_rapidjson::kWriteNanAndInfFlag>
         json_writer(output_string_buffer);
 
-    JSONEncoder<decltype(json_writer)> json_encoder(json_writer);
-
-    if (!SerializableObject::Writer::write_root(
+    if (!write_json_root(
             value,
-            json_encoder,
+            json_writer,
             schema_version_targets,
-            error_status))
+            error_status,
+            thread_count,
+            -1))
     {
         return std::string();
     }
@@ -1310,7 +1998,8 @@ serialize_json_to_string(
     const std::any&           value,
     const schema_version_map* schema_version_targets,
     ErrorStatus*              error_status,
-    int                       indent)
+    int                       indent,
+    int                       thread_count)
 {
     if (indent > 0)
     {
@@ -1318,12 +2007,14 @@ serialize_json_to_string(
             value,
             schema_version_targets,
             error_status,
-            indent);
+            indent,
+            thread_count);
     }
     return serialize_json_to_string_compact(
         value,
         schema_version_targets,
-        error_status);
+        error_status,
+        thread_count);
 }
 
 bool
@@ -1332,7 +2023,8 @@ serialize_json_to_file(
     std::string const&        file_name,
     const schema_version_map* schema_version_targets,
     ErrorStatus*              error_status,
-    int                       indent)
+    int                       indent,
+    int                       thread_count)
 {
 
 #if defined(_WINDOWS)
@@ -1364,23 +2056,223 @@ serialize_json_to_file(
         OTIO_rapidjson::UTF8<>,
         OTIO_rapidjson::CrtAllocator,
         OTIO_rapidjson::kWriteNanAndInfFlag>
-                                       json_writer(osw);
-    JSONEncoder<decltype(json_writer)> json_encoder(json_writer);
+        json_writer(osw);
 
     if (indent >= 0)
     {
         json_writer.SetIndent(' ', indent);
     }
 
-    status = SerializableObject::Writer::write_root(
+    // The default indent of a PrettyWriter is four spaces.
+    status = write_json_root(
         value,
-        json_encoder,
+        json_writer,
         schema_version_targets,
-        error_status);
+        error_status,
+        thread_count,
+        indent >= 0 ? indent : 4);
 
     return status;
 }
 
+std::string
+convert_json_string(
+    std::string const&        input,
+    const schema_version_map* schema_version_targets,
+    ErrorStatus*              error_status,
+    int                       indent)
+{
+    // Instancing needs the ids of every object in the input.
+#ifndef OTIO_INSTANCING_SUPPORT
+    OTIO_rapidjson::StringBuffer output_string_buffer;
+    OTIO_rapidjson::StringStream input_stream(input.c_str());
+
+    bool full_conversion = false;
+    bool status;
+    if (indent > 0)
+    {
+        OTIO_rapidjson::PrettyWriter<
+            decltype(output_string_buffer),
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::CrtAllocator,
+            OTIO_rapidjson::kWriteNanAndInfFlag>
+            json_writer(output_string_buffer);
+        json_writer.SetIndent(' ', indent);
+        status = convert_json(
+            input_stream,
+            json_writer,
+            schema_version_targets,
+            &full_conversion,
+            error_status);
+    }
+    else
+    {
+        OTIO_rapidjson::Writer<
+            decltype(output_string_buffer),
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::CrtAllocator,
+            OTIO_rapidjson::kWriteNanAndInfFlag>
+            json_writer(output_string_buffer);
+        status = convert_json(
+            input_stream,
+            json_writer,
+            schema_version_targets,
+            &full_conversion,
+            error_status);
+    }
+
+    if (status)
+    {
+        return std::string(output_string_buffer.GetString());
+    }
+    if (!full_conversion)
+    {
+        return std::string();
+    }
+#endif
+
+    std::any value;
+    if (!deserialize_json_from_string(input, &value, error_status))
+    {
+        return std::string();
+    }
+    return serialize_json_to_string(
+        value,
+        schema_version_targets,
+        error_status,
+        indent);
+}
+
+bool
+convert_json_file(
+    std::string const&        input_file_name,
+    std::string const&        output_file_name,
+    const schema_version_map* schema_version_targets,
+    ErrorStatus*              error_status,
+    int                       indent)
+{
+    // A file converted into itself is read whole before it is written.
+#ifndef OTIO_INSTANCING_SUPPORT
+    if (input_file_name != output_file_name)
+    {
+        FILE* fp = nullptr;
+#    if defined(_WINDOWS)
+        const int wlen = MultiByteToWideChar(
+            CP_UTF8,
+            0,
+            input_file_name.c_str(),
+            -1,
+            NULL,
+            0);
+        std::vector<wchar_t> wchars(wlen);
+        MultiByteToWideChar(
+            CP_UTF8,
+            0,
+            input_file_name.c_str(),
+            -1,
+            wchars.data(),
+            wlen);
+        if (_wfopen_s(&fp, wchars.data(), L"r") != 0)
+        {
+            fp = nullptr;
+        }
+#    else  // _WINDOWS
+        fp = fopen(input_file_name.c_str(), "r");
+#    endif // _WINDOWS
+        if (!fp)
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::FILE_OPEN_FAILED,
+                    input_file_name);
+            }
+            return false;
+        }
+
+#    if defined(_WINDOWS)
+        const int owlen = MultiByteToWideChar(
+            CP_UTF8,
+            0,
+            output_file_name.c_str(),
+            -1,
+            NULL,
+            0);
+        std::vector<wchar_t> owchars(owlen);
+        MultiByteToWideChar(
+            CP_UTF8,
+            0,
+            output_file_name.c_str(),
+            -1,
+            owchars.data(),
+            owlen);
+        std::ofstream os(owchars.data());
+#    else  // _WINDOWS
+        std::ofstream os(output_file_name);
+#    endif // _WINDOWS
+        if (!os.is_open())
+        {
+            fclose(fp);
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::FILE_WRITE_FAILED,
+                    output_file_name);
+            }
+            return false;
+        }
+
+        char                           read_buffer[65536];
+        OTIO_rapidjson::FileReadStream input_stream(
+            fp,
+            read_buffer,
+            sizeof(read_buffer));
+        OTIO_rapidjson::OStreamWrapper osw(os);
+
+        OTIO_rapidjson::PrettyWriter<
+            decltype(osw),
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::CrtAllocator,
+            OTIO_rapidjson::kWriteNanAndInfFlag>
+            json_writer(osw);
+        if (indent >= 0)
+        {
+            json_writer.SetIndent(' ', indent);
+        }
+
+        bool       full_conversion = false;
+        bool const status          = convert_json(
+            input_stream,
+            json_writer,
+            schema_version_targets,
+            &full_conversion,
+            error_status);
+        fclose(fp);
+        os.close();
+
+        if (!full_conversion)
+        {
+            return status;
+        }
+    }
+#endif
+
+    std::any value;
+    if (!deserialize_json_from_file(input_file_name, &value, error_status))
+    {
+        return false;
+    }
+    return serialize_json_to_file(
+        value,
+        output_file_name,
+        schema_version_targets,
+        error_status,
+        indent);
+}
+
 SerializableObject::Writer::~Writer()
 {
     if (_child_writer)
@@ -13,17 +13,58 @@
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+/**
+ * Serialize a value to JSON.
+ *
+ * With a thread_count other than one, the children of the stacks and
+ * collections at the top of the value, above any track (such as the tracks
+ * of a timeline, or of each timeline of a collection), are encoded on up to
+ * thread_count threads at once, zero meaning one per hardware thread, and
+ * copied into the output in order.  The output is the same either way.
+ * Builds with OTIO_INSTANCING_SUPPORT always use one thread, since the
+ * reference ids they write depend on the order in which the whole graph is
+ * written.
+ */
 std::string serialize_json_to_string(
     const std::any&           value,
     const schema_version_map* schema_version_targets = nullptr,
     ErrorStatus*              error_status           = nullptr,
-    int                       indent                 = 4);
+    int                       indent                 = 4,
+    int                       thread_count           = 1);
 
+/// Serialize a value to a JSON file; see serialize_json_to_string().
 bool serialize_json_to_file(
     const std::any&           value,
     std::string const&        file_name,
     const schema_version_map* schema_version_targets = nullptr,
     ErrorStatus*              error_status           = nullptr,
+    int                       indent                 = 4,
+    int                       thread_count           = 1);
+
+/**
+ * Convert serialized OTIO JSON so that each object is at the version it
+ * would be written at with schema_version_targets, as reading the JSON and
+ * serializing the result with serialize_json_to_string() would.
+ *
+ * The JSON is converted as it is read, so only the objects whose versions
+ * change (and the objects inside them) are read into memory, one at a
+ * time.  Other objects, and those of schemas that are not registered, are
+ * copied as they are.  JSON that OTIO did not write, with an OTIO_SCHEMA
+ * key other than first in an object, is read whole and serialized.
+ */
+std::string convert_json_string(
+    std::string const&        input,
+    const schema_version_map* schema_version_targets = nullptr,
+    ErrorStatus*              error_status           = nullptr,
+    int                       indent                 = 4);
+
+/// Convert a JSON file into another file as convert_json_string() does,
+/// with the indentation of serialize_json_to_file().
+bool convert_json_file(
+    std::string const&        input_file_name,
+    std::string const&        output_file_name,
+    const schema_version_map* schema_version_targets = nullptr,
+    ErrorStatus*              error_status           = nullptr,
     int                       indent                 = 4);
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
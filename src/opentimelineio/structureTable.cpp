@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/structureTable.h"
+#include "opentimelineio/clip.h"
+#include "opentimelineio/gap.h"
+#include "opentimelineio/stack.h"
+#include "opentimelineio/track.h"
+#include "opentimelineio/transition.h"
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+StructureTable::Kind
+kind_of(Composable const* object)
+{
+    if (dynamic_cast<Clip const*>(object))
+    {
+        return StructureTable::clip;
+    }
+    if (dynamic_cast<Gap const*>(object))
+    {
+        return StructureTable::gap;
+    }
+    if (dynamic_cast<Transition const*>(object))
+    {
+        return StructureTable::transition;
+    }
+    if (dynamic_cast<Track const*>(object))
+    {
+        return StructureTable::track;
+    }
+    if (dynamic_cast<Stack const*>(object))
+    {
+        return StructureTable::stack;
+    }
+    if (dynamic_cast<Composition const*>(object))
+    {
+        return StructureTable::other_composition;
+    }
+    return StructureTable::other;
+}
+
+} // namespace
+
+StructureTable
+StructureTable::build(Composition const* root, ErrorStatus* error_status)
+{
+    StructureTable table;
+    if (!root)
+    {
+        return table;
+    }
+
+    TimeRange const range = root->trimmed_range(error_status);
+    if (is_error(error_status))
+    {
+        return table;
+    }
+
+    // The root's own time is the time of the table.
+    RationalTime const offset(0, range.start_time().rate());
+    table._add_row(root, range, offset, 0, -1, -1);
+    if (!table._add_children(root, 0, offset, error_status))
+    {
+        return StructureTable();
+    }
+    return table;
+}
+
+StructureTable
+StructureTable::build(Timeline const* timeline, ErrorStatus* error_status)
+{
+    return build(timeline ? timeline->tracks() : nullptr, error_status);
+}
+
+void
+StructureTable::_add_row(
+    Composable const* object,
+    TimeRange const&  range,
+    RationalTime      offset,
+    int32_t           depth,
+    int64_t           parent,
+    int32_t           track_index)
+{
+    double const rate = range.duration().rate();
+    double       source_start = 0;
+    bool         enabled      = true;
+    if (auto item = dynamic_cast<Item const*>(object))
+    {
+        ErrorStatus     error_status;
+        TimeRange const trimmed = item->trimmed_range(&error_status);
+        if (!is_error(error_status))
+        {
+            source_start = trimmed.start_time().value_rescaled_to(rate);
+        }
+        enabled = item->enabled();
+    }
+
+    _objects.push_back(object);
+    _start.push_back((range.start_time() + offset).value_rescaled_to(rate));
+    _duration.push_back(range.duration().value());
+    _rate.push_back(rate);
+    _source_start.push_back(source_start);
+    _depth.push_back(depth);
+    _parent.push_back(parent);
+    _track_index.push_back(track_index);
+    _kind.push_back(kind_of(object));
+    _enabled.push_back(enabled ? 1 : 0);
+    _names += object->name();
+    _name_offsets.push_back(_names.size());
+}
+
+bool
+StructureTable::_add_children(
+    Composition const* composition,
+    size_t             row,
+    RationalTime       offset,
+    ErrorStatus*       error_status)
+{
+    // One call for the ranges of all of the children, rather than one per
+    // child, which for a track would be a scan of the children before it.
+    auto const ranges = composition->range_of_all_children(error_status);
+    if (is_error(error_status))
+    {
+        return false;
+    }
+
+    auto const&   children = composition->children();
+    int32_t const depth    = _depth[row] + 1;
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        Composable const* child = children[i];
+        auto const        found = ranges.find(children[i].value);
+        if (found == ranges.end())
+        {
+            continue;
+        }
+
+        size_t const child_row = size();
+        _add_row(
+            child,
+            found->second,
+            offset,
+            depth,
+            int64_t(row),
+            row == 0 ? int32_t(i) : _track_index[row]);
+
+        if (auto nested = dynamic_cast<Composition const*>(child))
+        {
+            // A time t inside the child is at
+            // range.start + (t - trimmed.start) inside this composition.
+            TimeRange const trimmed = nested->trimmed_range(error_status);
+            if (is_error(error_status))
+            {
+                return false;
+            }
+            RationalTime const child_offset =
+                offset + found->second.start_time() - trimmed.start_time();
+            if (!_add_children(nested, child_row, child_offset, error_status))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
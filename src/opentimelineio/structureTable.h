@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/composition.h"
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/version.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * The structure of a composition as a table with one row per object, and
+ * one array per column.
+ *
+ * The rows are the composition and every composable below it, in the
+ * order of a depth-first walk, so the rows of a composition's children
+ * follow it.  Each row holds the object's range, its kind, depth, parent
+ * row and top-level track, and the offsets of its name in one buffer of
+ * names.  Statistics over every clip of a large timeline are then loops
+ * over arrays, rather than a call per clip to find its range.
+ *
+ * Times are in the time of the root composition, as Item::range_in_parent()
+ * carried up through each ancestor.  Each row's start and duration are at
+ * the row's rate, which is that of its duration.  Time effects are not
+ * applied.  The table is a copy: it is not updated when the composition
+ * is edited.
+ */
+class StructureTable
+{
+public:
+    enum Kind : uint8_t
+    {
+        clip              = 0,
+        gap               = 1,
+        transition        = 2,
+        track             = 3,
+        stack             = 4,
+        other_composition = 5,
+        other             = 6
+    };
+
+    StructureTable() = default;
+
+    /// Tabulate a composition and every composable below it.
+    static StructureTable
+    build(Composition const* root, ErrorStatus* error_status = nullptr);
+
+    /// Tabulate the tracks of a timeline.  The stack of tracks is the root
+    /// row, and the global start time is not added.
+    static StructureTable
+    build(Timeline const* timeline, ErrorStatus* error_status = nullptr);
+
+    size_t size() const noexcept { return _objects.size(); }
+
+    /// The object of a row.  The table does not retain the objects.
+    Composable const* object(size_t row) const noexcept
+    {
+        return _objects[row];
+    }
+
+    /// The name of the object of a row.
+    std::string_view name(size_t row) const noexcept
+    {
+        return std::string_view(
+            _names.data() + _name_offsets[row],
+            _name_offsets[row + 1] - _name_offsets[row]);
+    }
+
+    /// The start of each row, in the time of the root.
+    std::vector<double> const& start() const noexcept { return _start; }
+
+    /// The duration of each row.
+    std::vector<double> const& duration() const noexcept { return _duration; }
+
+    /// The rate of each row's start and duration.
+    std::vector<double> const& rate() const noexcept { return _rate; }
+
+    /// The start of each item's trimmed range, such as the in point of a
+    /// clip in its media, at the row's rate; zero for a transition.
+    std::vector<double> const& source_start() const noexcept
+    {
+        return _source_start;
+    }
+
+    /// The depth of each row; the root is at depth zero.
+    std::vector<int32_t> const& depth() const noexcept { return _depth; }
+
+    /// The row of each row's parent; -1 for the root.
+    std::vector<int64_t> const& parent() const noexcept { return _parent; }
+
+    /// The index in the root of the child each row is in, which for a
+    /// timeline is the track; -1 for the root.
+    std::vector<int32_t> const& track_index() const noexcept
+    {
+        return _track_index;
+    }
+
+    /// The Kind of each row.
+    std::vector<uint8_t> const& kind() const noexcept { return _kind; }
+
+    /// Whether each row is enabled, for items; 1 for transitions.
+    std::vector<uint8_t> const& enabled() const noexcept { return _enabled; }
+
+    /// The names of every row, one after another, as UTF-8.
+    std::string const& names() const noexcept { return _names; }
+
+    /// The offset in names() of each row's name, and after the last, the
+    /// size of names(), so that row i's name is from name_offsets()[i] to
+    /// name_offsets()[i + 1].
+    std::vector<uint64_t> const& name_offsets() const noexcept
+    {
+        return _name_offsets;
+    }
+
+private:
+    void _add_row(
+        Composable const* object,
+        TimeRange const&  range,
+        RationalTime      offset,
+        int32_t           depth,
+        int64_t           parent,
+        int32_t           track_index);
+
+    bool _add_children(
+        Composition const* composition,
+        size_t             row,
+        RationalTime       offset,
+        ErrorStatus*       error_status);
+
+    std::vector<Composable const*> _objects;
+    std::vector<double>            _start;
+    std::vector<double>            _duration;
+    std::vector<double>            _rate;
+    std::vector<double>            _source_start;
+    std::vector<int32_t>           _depth;
+    std::vector<int64_t>           _parent;
+    std::vector<int32_t>           _track_index;
+    std::vector<uint8_t>           _kind;
+    std::vector<uint8_t>           _enabled;
+    std::string                    _names;
+    std::vector<uint64_t>          _name_offsets = { 0 };
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
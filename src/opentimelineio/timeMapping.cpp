@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/timeMapping.h"
+#include "opentimelineio/composition.h"
+#include "opentimelineio/linearTimeWarp.h"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+// t -> t * scale + offset, built up one step at a time.
+struct AffineChain
+{
+    double                      scale = 1;
+    std::optional<RationalTime> offset;
+
+    void then(double step_scale, RationalTime step_offset)
+    {
+        scale *= step_scale;
+        offset = offset ? RationalTime(
+                              offset->value() * step_scale,
+                              offset->rate())
+                              + step_offset
+                        : step_offset;
+    }
+};
+
+double
+time_scalar_of(Item const* item)
+{
+    double scalar = 1;
+    for (auto const& effect: item->effects())
+    {
+        if (auto warp = dynamic_cast<LinearTimeWarp const*>(effect.value))
+        {
+            scalar *= warp->time_scalar();
+        }
+    }
+    return scalar;
+}
+
+} // namespace
+
+TimeMapping::TimeMapping(
+    Item const* from_item,
+    Item const* to_item,
+    bool        apply_time_effects)
+    : _from_item(from_item)
+    , _to_item(to_item)
+    , _root_generation(0)
+    , _apply_time_effects(apply_time_effects)
+    , _compiled(false)
+{}
+
+bool
+TimeMapping::is_current() const noexcept
+{
+    return _compiled && (!_root
+                         || (!_root->parent()
+                             && _root->_timing_generation == _root_generation));
+}
+
+TimeTransform
+TimeMapping::transform(ErrorStatus* error_status)
+{
+    if (!is_current() && !_compile(error_status))
+    {
+        return TimeTransform();
+    }
+    return _transform;
+}
+
+RationalTime
+TimeMapping::applied_to(RationalTime time, ErrorStatus* error_status)
+{
+    if (!is_current() && !_compile(error_status))
+    {
+        return time;
+    }
+    return _transform.applied_to(time);
+}
+
+TimeRange
+TimeMapping::applied_to(TimeRange time_range, ErrorStatus* error_status)
+{
+    if (!is_current() && !_compile(error_status))
+    {
+        return time_range;
+    }
+    return _transform.applied_to(time_range);
+}
+
+bool
+TimeMapping::_compile(ErrorStatus* error_status)
+{
+    _compiled  = false;
+    _root      = nullptr;
+    _transform = TimeTransform();
+
+    if (!_from_item || !_to_item)
+    {
+        // as with transformed_time(), no destination means no change
+        _compiled = true;
+        return true;
+    }
+
+    std::vector<Item const*> from_path;
+    for (Item const* item = _from_item; item; item = item->parent())
+    {
+        from_path.push_back(item);
+    }
+
+    std::vector<Item const*> to_path;
+    Item const*              ancestor = nullptr;
+    for (Item const* item = _to_item; item; item = item->parent())
+    {
+        if (std::find(from_path.begin(), from_path.end(), item)
+            != from_path.end())
+        {
+            ancestor = item;
+            break;
+        }
+        to_path.push_back(item);
+    }
+
+    if (!ancestor)
+    {
+        if (error_status)
+        {
+            *error_status = ErrorStatus(
+                ErrorStatus::NOT_DESCENDED_FROM,
+                "items do not share a common ancestor",
+                _to_item);
+        }
+        return false;
+    }
+
+    AffineChain chain;
+
+    // Up from the from item to the common ancestor: parent time is the
+    // start of the child's range in the parent, plus the child's content
+    // time from the start of its trimmed range, divided by its speed.
+    for (Item const* item: from_path)
+    {
+        if (item == ancestor)
+        {
+            break;
+        }
+
+        RationalTime const trimmed_start =
+            item->trimmed_range(error_status).start_time();
+        if (is_error(error_status))
+        {
+            return false;
+        }
+        RationalTime const range_start =
+            item->parent()->range_of_child(item, error_status).start_time();
+        if (is_error(error_status))
+        {
+            return false;
+        }
+
+        double const scalar = _apply_time_effects ? time_scalar_of(item) : 1;
+        if (scalar == 1)
+        {
+            chain.then(1, range_start - trimmed_start);
+        }
+        else if (scalar == 0)
+        {
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::INVALID_TIME_RANGE,
+                    "cannot map a time out of a freeze frame",
+                    item);
+            }
+            return false;
+        }
+        else
+        {
+            chain.then(
+                1 / scalar,
+                range_start
+                    - RationalTime(
+                        trimmed_start.value() / scalar,
+                        trimmed_start.rate()));
+        }
+    }
+
+    // And back down to the to item, inverting each step.
+    for (auto i = to_path.rbegin(); i != to_path.rend(); ++i)
+    {
+        Item const* item = *i;
+
+        RationalTime const trimmed_start =
+            item->trimmed_range(error_status).start_time();
+        if (is_error(error_status))
+        {
+            return false;
+        }
+        RationalTime const range_start =
+            item->parent()->range_of_child(item, error_status).start_time();
+        if (is_error(error_status))
+        {
+            return false;
+        }
+
+        double const scalar = _apply_time_effects ? time_scalar_of(item) : 1;
+        chain.then(
+            scalar,
+            trimmed_start
+                - RationalTime(range_start.value() * scalar, range_start.rate()));
+    }
+
+    Composable const* root = from_path.back();
+    _root                  = root;
+    _root_generation       = root->_timing_generation;
+    _transform =
+        TimeTransform(chain.offset.value_or(RationalTime()), chain.scale);
+    _compiled = true;
+    return true;
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
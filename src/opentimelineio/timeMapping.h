@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/errorStatus.h"
+#include "opentimelineio/item.h"
+#include "opentimelineio/version.h"
+
+#include <cstdint>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * A compiled mapping of times from one item to another in the same
+ * hierarchy.
+ *
+ * Item::transformed_time() walks up to the common ancestor and back down
+ * on every call, and each step asks the parent for the range of the child,
+ * which for a track is a scan of the children before it.  A TimeMapping
+ * does that walk once and folds the steps into a single affine
+ * TimeTransform, so that mapping each further time is a multiply and an
+ * add.
+ *
+ * The mapping is recompiled the next time it is used after anything in the
+ * hierarchy is edited through its API: children being added, removed or
+ * replaced, or a source range, transition offset or media reference
+ * changing.  Edits that are not made through an item (the available range
+ * of a media reference, time effects, or the effects list itself) are not
+ * seen; call invalidate() after making them.
+ *
+ * When apply_time_effects is true, the LinearTimeWarps (and so
+ * FreezeFrames) on each item between the two are folded in, scaling the
+ * item's content time relative to the start of its trimmed range.  A
+ * freeze frame cannot be mapped out of, so mapping from an item with one
+ * up to its parent is an error.  Other time effects are ignored.
+ *
+ * Without time effects, the result equals that of transformed_time(); the
+ * offsets are summed before being applied rather than after, so at mixed
+ * rates the two can differ by floating point rounding.
+ *
+ * A TimeMapping retains both items, and once compiled, the root of their
+ * hierarchy.  It is not safe to use one mapping from several threads at
+ * once, since using it may recompile it.
+ */
+class TimeMapping
+{
+public:
+    TimeMapping(
+        Item const* from_item,
+        Item const* to_item,
+        bool        apply_time_effects = false);
+
+    Item const* from_item() const noexcept { return _from_item; }
+
+    Item const* to_item() const noexcept { return _to_item; }
+
+    bool apply_time_effects() const noexcept { return _apply_time_effects; }
+
+    /// The mapping as a transform, compiling it first if need be.
+    TimeTransform transform(ErrorStatus* error_status = nullptr);
+
+    /// Map a time in the from item to the to item.
+    RationalTime
+    applied_to(RationalTime time, ErrorStatus* error_status = nullptr);
+
+    /// Map a range in the from item to the to item.
+    TimeRange
+    applied_to(TimeRange time_range, ErrorStatus* error_status = nullptr);
+
+    /// Whether the compiled mapping is up to date with the hierarchy.
+    bool is_current() const noexcept;
+
+    /// Force the mapping to be recompiled the next time it is used.
+    void invalidate() noexcept { _compiled = false; }
+
+private:
+    bool _compile(ErrorStatus* error_status);
+
+    SerializableObject::Retainer<Item>       _from_item;
+    SerializableObject::Retainer<Item>       _to_item;
+    SerializableObject::Retainer<Composable> _root;
+    uint64_t                                 _root_generation;
+    TimeTransform                            _transform;
+    bool                                     _apply_time_effects;
+    bool                                     _compiled;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
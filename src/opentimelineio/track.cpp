@@ -7,8 +7,96 @@
 #include "opentimelineio/transition.h"
 #include "opentimelineio/vectorIndexing.h"
 
+#include "opentime/exactTime.h"
+
+#include <algorithm>
+#include <cmath>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+using opentime::ExactTime;
+
+namespace {
+
+// The sum of the durations of the children before a child, which is where
+// the child starts.  While every duration is a whole number of frames at an
+// exact rate, the sum is kept as an ExactTime, and rounded only when a start
+// time is taken from it, so that long runs of NTSC durations do not drift.
+// A duration at the rate of the sum, which is usually every one, costs an
+// integer addition; anything else falls back to adding RationalTimes.
+class DurationSum
+{
+public:
+    void add(RationalTime duration) noexcept
+    {
+        _max_rate = std::max(_max_rate, duration.rate());
+        if (_is_exact)
+        {
+            if (auto sum = _exact_sum(duration))
+            {
+                if (_exact_rate == 0 || !sum->same_rate(_exact))
+                {
+                    _exact_rate = sum->rate();
+                }
+                _exact = *sum;
+                return;
+            }
+            _is_exact = false;
+            _inexact  = _exact.to_rational_time();
+        }
+        _inexact += duration;
+    }
+
+    // The sum at the given rate.
+    RationalTime at_rate(double rate) const noexcept
+    {
+        if (!_is_exact)
+        {
+            return _inexact.rescaled_to(rate);
+        }
+        return rate == _exact_rate ? RationalTime(double(_exact.value()), rate)
+                                   : _exact.to_rational_time(rate);
+    }
+
+    // The largest rate of the durations added, or zero if there are none.
+    double max_rate() const noexcept { return _max_rate; }
+
+private:
+    std::optional<ExactTime> _exact_sum(RationalTime duration) const noexcept
+    {
+        if (_exact_rate == 0)
+        {
+            return ExactTime::from_rational_time(duration);
+        }
+
+        ExactTime    sum;
+        double const value = duration.value();
+        if (duration.rate() == _exact_rate && value == std::trunc(value)
+            && std::fabs(value) < 9007199254740992.0)
+        {
+            sum = _exact.plus_frames(int64_t(value));
+        }
+        else if (auto exact = ExactTime::from_rational_time(duration))
+        {
+            sum = _exact + *exact;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+        return sum.is_invalid_time() ? std::nullopt
+                                     : std::optional<ExactTime>(sum);
+    }
+
+    bool         _is_exact = true;
+    ExactTime    _exact;
+    double       _exact_rate = 0; // zero until a duration has been added
+    RationalTime _inexact;
+    double       _max_rate = 0;
+};
+
+} // namespace
+
 Track::Track(
     std::string const&              name,
     std::optional<TimeRange> const& source_range,
@@ -61,14 +149,13 @@ Track::range_of_child_at_index(int index, ErrorStatus* error_status) const
         return TimeRange();
     }
 
-    RationalTime start_time(0, child_duration.rate());
-
+    DurationSum preceding;
     for (int i = 0; i < index; i++)
     {
         Composable* child2 = children()[i];
         if (!child2->overlapping())
         {
-            start_time += children()[i]->duration(error_status);
+            preceding.add(child2->duration(error_status));
         }
         if (is_error(error_status))
         {
@@ -76,6 +163,10 @@ Track::range_of_child_at_index(int index, ErrorStatus* error_status) const
         }
     }
 
+    // At the rate that adding up the durations as RationalTimes gives.
+    RationalTime start_time = preceding.at_rate(
+        std::max(preceding.max_rate(), child_duration.rate()));
+
     if (auto transition = dynamic_cast<Transition*>(child))
     {
         start_time -= transition->in_offset();
@@ -236,22 +327,24 @@ Track::range_of_all_children(ErrorStatus* error_status) const
         }
     }
 
-    RationalTime last_end_time(0, rate);
+    // The sum is the same as range_of_child_at_index() takes, but each
+    // start time is at the rate of the item before it.
+    DurationSum end_time;
     for (const auto& child: children())
     {
         if (auto transition = dynamic_retainer_cast<Transition>(child))
         {
             result[child] = TimeRange(
-                last_end_time - transition->in_offset(),
+                end_time.at_rate(rate) - transition->in_offset(),
                 transition->out_offset() + transition->in_offset());
         }
         else if (auto item = dynamic_retainer_cast<Item>(child))
         {
-            auto last_range = TimeRange(
-                last_end_time,
-                item->trimmed_range(error_status).duration());
-            result[child] = last_range;
-            last_end_time = last_range.end_time_exclusive();
+            RationalTime const duration =
+                item->trimmed_range(error_status).duration();
+            result[child] = TimeRange(end_time.at_rate(rate), duration);
+            end_time.add(duration);
+            rate = duration.rate();
         }
 
         if (is_error(error_status))
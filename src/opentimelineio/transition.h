@@ -46,6 +46,7 @@ public:
     void set_in_offset(RationalTime const& in_offset) noexcept
     {
         _in_offset = in_offset;
+        _timing_changed();
     }
 
     RationalTime out_offset() const noexcept { return _out_offset; }
@@ -53,6 +54,7 @@ public:
     void set_out_offset(RationalTime const& out_offset) noexcept
     {
         _out_offset = out_offset;
+        _timing_changed();
     }
 
     RationalTime duration(ErrorStatus* error_status = nullptr) const override;
@@ -175,6 +175,7 @@ TypeRegistry::register_type(
         if (type)
         {
             _type_records_by_type_name[type->name()] = r;
+            _publish_type_info(type, r);
         }
         return true;
     }
@@ -306,7 +307,21 @@ TypeRegistry::_instance_from_schema(
         }
         return nullptr;
     }
-    else if (schema_version < type_record->schema_version)
+
+    // Only a SerializableObjectWithMetadata keeps metadata read lazily as
+    // JSON; other schemas, such as one that leaves it in its dynamic
+    // fields, and upgrade functions see it as values.
+    if (schema_version < type_record->schema_version
+        || !dynamic_cast<SerializableObjectWithMetadata*>(so))
+    {
+        auto metadata = dict.find("metadata");
+        if (metadata != dict.end())
+        {
+            SerializableObject::Reader::_parse_raw_json(metadata->second);
+        }
+    }
+
+    if (schema_version < type_record->schema_version)
     {
         for (const auto& e: type_record->upgrade_functions)
         {
@@ -347,9 +362,40 @@ TypeRegistry::_lookup_type_record(std::string const& schema_name)
 TypeRegistry::_TypeRecord*
 TypeRegistry::_lookup_type_record(std::type_info const& type)
 {
+    if (auto map = _type_info_map.load(std::memory_order_acquire))
+    {
+        auto const e = map->find(&type);
+        if (e != map->end())
+        {
+            return e->second;
+        }
+    }
+
+    // The same type can have more than one type_info when it crosses a
+    // shared library boundary, so fall back on its name, and publish this
+    // type_info too so that the next lookup of it takes no lock.
     std::lock_guard<std::mutex> lock(_registry_mutex);
     auto e = _type_records_by_type_name.find(type.name());
-    return e != _type_records_by_type_name.end() ? e->second : nullptr;
+    if (e == _type_records_by_type_name.end())
+    {
+        return nullptr;
+    }
+    _publish_type_info(&type, e->second);
+    return e->second;
+}
+
+void
+TypeRegistry::_publish_type_info(
+    std::type_info const* type,
+    _TypeRecord*          record)
+{
+    // Called with _registry_mutex held.
+    auto const current = _type_info_map.load(std::memory_order_relaxed);
+    auto       map     = current ? std::make_unique<_TypeInfoMap>(*current)
+                                 : std::make_unique<_TypeInfoMap>();
+    (*map)[type] = record;
+    _type_info_map.store(map.get(), std::memory_order_release);
+    _type_info_maps.push_back(std::move(map));
 }
 
 SerializableObject*
@@ -7,11 +7,15 @@
 #include "opentimelineio/version.h"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
@@ -182,6 +186,7 @@ private:
         friend class TypeRegistry;
         friend class SerializableObject;
         friend class CloningEncoder;
+        friend class SchemaVersionTargets;
     };
 
     // helper functions for lookup
@@ -203,12 +208,26 @@ private:
     _TypeRecord* _lookup_type_record(std::string const& schema_name);
     _TypeRecord* _lookup_type_record(std::type_info const& type);
 
+    // The records of C++ types by type_info address, for lookups without
+    // the registry mutex.  The map is never changed once published: each
+    // new entry publishes a copy.  Lookups are rare after the first of each
+    // type, so copying is cheap, and earlier copies are kept until the
+    // registry is destroyed, since a reader may still be using one.
+    using _TypeInfoMap =
+        std::unordered_map<std::type_info const*, _TypeRecord*>;
+
+    void _publish_type_info(std::type_info const* type, _TypeRecord* record);
+
     std::mutex                          _registry_mutex;
     std::map<std::string, _TypeRecord*> _type_records;
     std::map<std::string, _TypeRecord*> _type_records_by_type_name;
 
+    std::atomic<_TypeInfoMap const*>           _type_info_map{ nullptr };
+    std::vector<std::unique_ptr<_TypeInfoMap>> _type_info_maps;
+
     friend class SerializableObject;
     friend class CloningEncoder;
+    friend class SchemaVersionTargets;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
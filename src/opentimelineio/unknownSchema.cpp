@@ -20,6 +20,10 @@ UnknownSchema::read_from(Reader& reader)
 {
     _data.swap(reader._dict);
     _data.erase("OTIO_SCHEMA");
+    for (auto& e: _data)
+    {
+        Reader::_parse_raw_json(e.second);
+    }
     return true;
 }
 
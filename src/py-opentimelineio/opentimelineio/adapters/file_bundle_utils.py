@@ -5,6 +5,8 @@
 
 import os
 import copy
+import concurrent.futures
+import hashlib
 
 from .. import (
     exceptions,
@@ -23,6 +25,9 @@ BUNDLE_VERSION_FILE = "version.txt"
 BUNDLE_PLAYLIST_PATH = "content.otio"
 BUNDLE_DIR_NAME = "media"
 
+# size of the reads used when checksumming media files
+_HASH_CHUNK_SIZE = 1024 * 1024
+
 
 class NotAFileOnDisk(exceptions.OTIOError):
     pass
@@ -65,10 +70,121 @@ def _guarantee_unique_basenames(path_list, adapter_name):
         basename_to_source_fn[new_basename] = fn
 
 
+def _run_in_pool(
+    fn,
+    items,
+    max_workers=None,
+    progress_callback=None,
+    weights=None,
+):
+    """Apply fn to each of items on a bounded pool of worker threads and
+    return the results in the same order as items.
+
+    Bundling is dominated by file system latency rather than computation, so
+    threads overlap the waiting even though they share the GIL.  max_workers
+    bounds the pool (None uses the concurrent.futures default); with a single
+    worker, or a single item, fn is simply called in turn.
+
+    If progress_callback is given, it is called on the calling thread as
+    progress_callback(done, total) as each item finishes, where done and total
+    are sums of weights (one per item if weights is not given).
+    """
+
+    items = list(items)
+    if weights is None:
+        weights = [1] * len(items)
+    total = sum(weights)
+    done = 0
+
+    if max_workers == 1 or len(items) <= 1:
+        results = []
+        for item, weight in zip(items, weights):
+            results.append(fn(item))
+            if progress_callback is not None:
+                done += weight
+                progress_callback(done, total)
+        return results
+
+    results = [None] * len(items)
+    with concurrent.futures.ThreadPoolExecutor(max_workers) as pool:
+        futures = {
+            pool.submit(fn, item): index for index, item in enumerate(items)
+        }
+        try:
+            for future in concurrent.futures.as_completed(futures):
+                index = futures[future]
+                results[index] = future.result()
+                if progress_callback is not None:
+                    done += weights[index]
+                    progress_callback(done, total)
+        except BaseException:
+            # don't start any more work once something has failed
+            for future in futures:
+                future.cancel()
+            raise
+
+    return results
+
+
+def _content_hash_of(filepath):
+    digest = hashlib.sha256()
+    with open(filepath, "rb") as fi:
+        for chunk in iter(lambda: fi.read(_HASH_CHUNK_SIZE), b""):
+            digest.update(chunk)
+    return digest.hexdigest()
+
+
+def _deduplicated_by_content(path_to_reference_map, max_workers=None):
+    """Merge the entries of path_to_reference_map whose files have identical
+    contents, so that each distinct file is bundled only once.  The first path
+    (in manifest order) of each set of duplicates is kept, and the media
+    references of the others are added to it.
+
+    Only files that share their size with another file are checksummed.
+    """
+
+    paths = list(path_to_reference_map.keys())
+    sizes = _file_sizes_of(paths, max_workers)
+
+    paths_by_size = {}
+    for path, size in zip(paths, sizes):
+        paths_by_size.setdefault(size, []).append(path)
+
+    candidates = [
+        path
+        for same_size in paths_by_size.values() if len(same_size) > 1
+        for path in same_size
+    ]
+    path_to_hash = dict(
+        zip(
+            candidates,
+            _run_in_pool(_content_hash_of, candidates, max_workers)
+        )
+    )
+
+    result = {}
+    hash_to_path = {}
+    for path in paths:
+        content_hash = path_to_hash.get(path)
+        if content_hash is not None and content_hash in hash_to_path:
+            result[hash_to_path[content_hash]].extend(
+                path_to_reference_map[path]
+            )
+            continue
+
+        if content_hash is not None:
+            hash_to_path[content_hash] = path
+        result[path] = list(path_to_reference_map[path])
+
+    return result
+
+
 def _prepped_otio_for_bundle_and_manifest(
     input_otio,    # otio to process
     media_policy,  # how to handle media references (see: MediaReferencePolicy)
     adapter_name,  # just for error messages
+    deduplicate_media=False,  # bundle files with identical contents once
+    max_workers=None,  # bound on the threads used to examine media files
 ):
     """ Create a new OTIO based on input_otio that has had media references
     replaced according to the media_policy.  Return that new OTIO and a
@@ -77,6 +193,10 @@ def _prepped_otio_for_bundle_and_manifest(
     the OTIO will be relinked by the adapters to point to their output
     locations.
 
+    If deduplicate_media is True, files with identical contents are collapsed
+    into a single entry of the mapping (see _deduplicated_by_content), so that
+    differently named copies of the same media are only bundled once.
+
     The otio[dz] adapters use this function to do further relinking and build
     their bundles.
 
@@ -89,7 +209,9 @@ def _prepped_otio_for_bundle_and_manifest(
     result_otio = copy.deepcopy(input_otio)
 
     path_to_reference_map = {}
-    invalid_files = set()
+
+    # clips paired with the absolute path of the file they reference
+    clips_and_files = []
 
     # result_otio is manipulated in place
     for cl in result_otio.find_clips():
@@ -128,18 +250,21 @@ def _prepped_otio_for_bundle_and_manifest(
 
         # get an absolute path to the target file
         target_file = os.path.abspath(url_utils.filepath_from_url(target_url))
+        clips_and_files.append((cl, target_file))
+
+    # check each distinct file once, concurrently, since on network storage
+    # the round trips dominate
+    unique_files = list(dict.fromkeys(fn for _, fn in clips_and_files))
+    invalid_files = {
+        fn
+        for fn, is_file in zip(
+            unique_files,
+            _run_in_pool(os.path.isfile, unique_files, max_workers)
+        )
+        if not is_file
+    }
 
-        # if the file hasn't already been checked
-        if (
-            target_file not in path_to_reference_map
-            and target_file not in invalid_files
-            and (
-                not os.path.exists(target_file)
-                or not os.path.isfile(target_file)
-            )
-        ):
-            invalid_files.add(target_file)
-
+    for cl, target_file in clips_and_files:
         if target_file in invalid_files:
             if media_policy is MediaReferencePolicy.ErrorIfNotFile:
                 raise NotAFileOnDisk(target_file)
@@ -160,13 +285,20 @@ def _prepped_otio_for_bundle_and_manifest(
             cl.media_reference
         )
 
+    if deduplicate_media:
+        path_to_reference_map = _deduplicated_by_content(
+            path_to_reference_map,
+            max_workers
+        )
+
     _guarantee_unique_basenames(path_to_reference_map.keys(), adapter_name)
 
     return result_otio, path_to_reference_map
 
 
-def _total_file_size_of(filepaths):
-    fsize = 0
-    for fn in filepaths:
-        fsize += os.path.getsize(fn)
-    return fsize
+def _file_sizes_of(filepaths, max_workers=None):
+    return _run_in_pool(os.path.getsize, filepaths, max_workers)
+
+
+def _total_file_size_of(filepaths, max_workers=None):
+    return sum(_file_sizes_of(filepaths, max_workers))
@@ -60,7 +60,14 @@ def write_to_file(
     # see documentation in file_bundle_utils for more information on the
     # media_policy
     media_policy=utils.MediaReferencePolicy.ErrorIfNotFile,
-    dryrun=False
+    dryrun=False,
+    # bundle media files with identical contents only once
+    deduplicate_media=False,
+    # maximum number of threads used to examine and copy media files
+    max_workers=None,
+    # called as progress_callback(bytes_done, bytes_total) while media is
+    # being written
+    progress_callback=None,
 ):
 
     if os.path.exists(filepath):
@@ -94,12 +101,14 @@ def write_to_file(
     result_otio, path_to_mr_map = utils._prepped_otio_for_bundle_and_manifest(
         input_otio,
         media_policy,
-        "OTIOD"
+        "OTIOD",
+        deduplicate_media=deduplicate_media,
+        max_workers=max_workers,
     )
 
     # dryrun reports the total size of files
     if dryrun:
-        return utils._total_file_size_of(path_to_mr_map.keys())
+        return utils._total_file_size_of(path_to_mr_map.keys(), max_workers)
 
     abspath_to_output_path_map = {}
 
@@ -134,7 +143,16 @@ def write_to_file(
 
     # write the media files
     os.mkdir(os.path.join(filepath, utils.BUNDLE_DIR_NAME))
-    for src, dst in abspath_to_output_path_map.items():
-        shutil.copyfile(src, dst)
+    copies = list(abspath_to_output_path_map.items())
+    utils._run_in_pool(
+        lambda src_and_dst: shutil.copyfile(*src_and_dst),
+        copies,
+        max_workers,
+        progress_callback,
+        weights=(
+            utils._file_sizes_of([src for src, _ in copies], max_workers)
+            if progress_callback is not None else None
+        ),
+    )
 
     return
@@ -75,7 +75,14 @@ def write_to_file(
     # see documentation in file_bundle_utils for more information on the
     # media_policy
     media_policy=utils.MediaReferencePolicy.ErrorIfNotFile,
-    dryrun=False
+    dryrun=False,
+    # bundle media files with identical contents only once
+    deduplicate_media=False,
+    # maximum number of threads used to examine media files
+    max_workers=None,
+    # called as progress_callback(bytes_done, bytes_total) while media is
+    # being written
+    progress_callback=None,
 ):
     if os.path.exists(filepath):
         raise exceptions.OTIOError(
@@ -96,12 +103,14 @@ def write_to_file(
     result_otio, path_to_mr_map = utils._prepped_otio_for_bundle_and_manifest(
         input_otio,
         media_policy,
-        "OTIOZ"
+        "OTIOZ",
+        deduplicate_media=deduplicate_media,
+        max_workers=max_workers,
     )
 
     # dryrun reports the total size of files
     if dryrun:
-        return utils._total_file_size_of(path_to_mr_map.keys())
+        return utils._total_file_size_of(path_to_mr_map.keys(), max_workers)
 
     abspath_to_output_path_map = {}
 
@@ -150,8 +159,19 @@ def write_to_file(
             compress_type=zipfile.ZIP_DEFLATED
         )
 
-        # write the media (uncompressed)
-        for src, dst in abspath_to_output_path_map.items():
+        # write the media (uncompressed).  A zip archive has to be written
+        # sequentially, so unlike the otiod adapter the copies themselves are
+        # not spread across threads.
+        sizes = (
+            utils._file_sizes_of(abspath_to_output_path_map.keys(), max_workers)
+            if progress_callback is not None else []
+        )
+        bytes_total = sum(sizes)
+        bytes_done = 0
+        for index, (src, dst) in enumerate(abspath_to_output_path_map.items()):
             target.write(src, dst, compress_type=zipfile.ZIP_STORED)
+            if progress_callback is not None:
+                bytes_done += sizes[index]
+                progress_callback(bytes_done, bytes_total)
 
     return
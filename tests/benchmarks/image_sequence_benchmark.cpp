@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/imageSequenceReference.h"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+// A sequence of state.range(0) images.
+static otio::SerializableObject::Retainer<otio::ImageSequenceReference>
+make_sequence(benchmark::State const& state)
+{
+    return new otio::ImageSequenceReference(
+        "file:///show/seq/shot/rndr/",
+        "show_shot.",
+        ".exr",
+        1001,
+        1,
+        24,
+        4,
+        otio::ImageSequenceReference::MissingFramePolicy::error,
+        otio::TimeRange(
+            otio::RationalTime(0, 24),
+            otio::RationalTime(double(state.range(0)), 24)));
+}
+
+static void
+BM_TargetUrlForImageNumber(benchmark::State& state)
+{
+    auto const               sequence = make_sequence(state);
+    std::vector<std::string> urls;
+    for (auto _: state)
+    {
+        urls.clear();
+        int const count = sequence->number_of_images_in_sequence();
+        for (int i = 0; i < count; ++i)
+        {
+            urls.push_back(sequence->target_url_for_image_number(i));
+        }
+        benchmark::DoNotOptimize(urls.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TargetUrlForImageNumber)->Arg(1000)->Arg(100000);
+
+static void
+BM_TargetUrlsInRange(benchmark::State& state)
+{
+    auto const               sequence = make_sequence(state);
+    auto const               range    = *sequence->available_range();
+    std::vector<std::string> urls;
+    for (auto _: state)
+    {
+        sequence->target_urls_in_range(range, urls);
+        benchmark::DoNotOptimize(urls.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TargetUrlsInRange)->Arg(1000)->Arg(100000);
+
+static void
+BM_ForEachTargetUrlInRange(benchmark::State& state)
+{
+    auto const sequence = make_sequence(state);
+    auto const range    = *sequence->available_range();
+    for (auto _: state)
+    {
+        size_t length = 0;
+        sequence->for_each_target_url_in_range(
+            range,
+            [&length](int, std::string const& url) { length += url.size(); });
+        benchmark::DoNotOptimize(length);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ForEachTargetUrlInRange)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
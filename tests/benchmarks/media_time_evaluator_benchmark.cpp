@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/clip.h"
+#include "opentimelineio/mediaTimeEvaluator.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/track.h"
+#include <benchmark/benchmark.h>
+
+namespace otime = opentime::OPENTIME_VERSION;
+namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
+
+// A timeline of one track of state.range(0) clips of 48 frames each,
+// evaluated at every frame.
+static otio::SerializableObject::Retainer<otio::Timeline>
+make_timeline(benchmark::State const& state)
+{
+    otio::SerializableObject::Retainer<otio::Timeline> timeline =
+        new otio::Timeline();
+    auto track = new otio::Track();
+    timeline->tracks()->append_child(track);
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        track->append_child(new otio::Clip(
+            "clip",
+            nullptr,
+            otio::TimeRange(
+                otio::RationalTime(double(i % 7), 24),
+                otio::RationalTime(48, 24))));
+    }
+    return timeline;
+}
+
+static void
+BM_ChildAtTime(benchmark::State& state)
+{
+    auto const   timeline = make_timeline(state);
+    auto const   track    = timeline->tracks()->children()[0].value;
+    auto const   stack    = timeline->tracks();
+    double const frames   = double(state.range(0) * 48);
+    for (auto _: state)
+    {
+        for (double frame = 0; frame < frames; ++frame)
+        {
+            otio::RationalTime const time(frame, 24);
+            auto const               item =
+                dynamic_cast<otio::Track*>(track)->child_at_time(time);
+            auto const clip = dynamic_cast<otio::Clip*>(item.value);
+            benchmark::DoNotOptimize(stack->transformed_time(time, clip));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(frames));
+}
+BENCHMARK(BM_ChildAtTime)->Arg(100);
+
+static void
+BM_Evaluate(benchmark::State& state)
+{
+    auto const               timeline = make_timeline(state);
+    otio::MediaTimeEvaluator evaluator(timeline);
+    double const             frames = double(state.range(0) * 48);
+    for (auto _: state)
+    {
+        for (double frame = 0; frame < frames; ++frame)
+        {
+            benchmark::DoNotOptimize(
+                evaluator.evaluate(0, otio::RationalTime(frame, 24)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(frames));
+}
+BENCHMARK(BM_Evaluate)->Arg(100)->Arg(1000);
+
+static void
+BM_EvaluateBatch(benchmark::State& state)
+{
+    auto const               timeline = make_timeline(state);
+    otio::MediaTimeEvaluator evaluator(timeline);
+    int64_t const            frames = state.range(0) * 48;
+    otime::RationalTimeArray times(size_t(frames), 24);
+    for (int64_t frame = 0; frame < frames; ++frame)
+    {
+        times.values()[frame] = double(frame);
+    }
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(evaluator.evaluate(0, times));
+    }
+    state.SetItemsProcessed(state.iterations() * frames);
+}
+BENCHMARK(BM_EvaluateBatch)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
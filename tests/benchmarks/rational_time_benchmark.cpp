@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentime/rationalTime.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace otime = opentime::OPENTIME_VERSION;
+
+static constexpr double ntsc_rate = 24000.0 / 1001.0;
+
+// Durations as they turn up in a track: mostly one rate, with every
+// state.range(1)'th at another rate (0 means all at the same rate).
+static std::vector<otime::RationalTime>
+make_times(benchmark::State const& state)
+{
+    size_t const                     count = size_t(state.range(0));
+    size_t const                     every = size_t(state.range(1));
+    std::vector<otime::RationalTime> times(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        double const rate = every && i % every == 0 ? 48 : ntsc_rate;
+        times[i]          = otime::RationalTime(double(i % 97 + 1), rate);
+    }
+    return times;
+}
+
+static void
+BM_Add(benchmark::State& state)
+{
+    auto const times = make_times(state);
+    for (auto _: state)
+    {
+        otime::RationalTime sum(0, ntsc_rate);
+        for (auto const& time: times)
+        {
+            sum = sum + time;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Add)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+static void
+BM_AddAssign(benchmark::State& state)
+{
+    auto const times = make_times(state);
+    for (auto _: state)
+    {
+        otime::RationalTime sum(0, ntsc_rate);
+        for (auto const& time: times)
+        {
+            sum += time;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddAssign)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+static void
+BM_Subtract(benchmark::State& state)
+{
+    auto const times = make_times(state);
+    for (auto _: state)
+    {
+        otime::RationalTime difference(0, ntsc_rate);
+        for (auto const& time: times)
+        {
+            difference = difference - time;
+        }
+        benchmark::DoNotOptimize(difference);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Subtract)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+static void
+BM_LessThan(benchmark::State& state)
+{
+    auto const                times = make_times(state);
+    otime::RationalTime const pivot(48, ntsc_rate);
+    for (auto _: state)
+    {
+        size_t count = 0;
+        for (auto const& time: times)
+        {
+            count += time < pivot;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LessThan)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+static void
+BM_Equal(benchmark::State& state)
+{
+    auto const                times = make_times(state);
+    otime::RationalTime const pivot(48, ntsc_rate);
+    for (auto _: state)
+    {
+        size_t count = 0;
+        for (auto const& time: times)
+        {
+            count += time == pivot;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Equal)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+static void
+BM_RescaledTo(benchmark::State& state)
+{
+    auto const times = make_times(state);
+    for (auto _: state)
+    {
+        double sum = 0;
+        for (auto const& time: times)
+        {
+            sum += time.value_rescaled_to(ntsc_rate);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RescaledTo)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+static void
+BM_ToSeconds(benchmark::State& state)
+{
+    auto const times = make_times(state);
+    for (auto _: state)
+    {
+        double sum = 0;
+        for (auto const& time: times)
+        {
+            sum += time.to_seconds();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ToSeconds)->Args({ 10000, 0 })->Args({ 10000, 10 });
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/clip.h"
+#include "opentimelineio/externalReference.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/track.h"
+#include <benchmark/benchmark.h>
+#include <string>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+// A single track timeline of clips whose metadata holds a mix of the value
+// types the Writer has to dispatch on.
+static otio::SerializableObject::Retainer<otio::Timeline>
+make_timeline(int clip_count)
+{
+    otio::SerializableObject::Retainer<otio::Timeline> timeline(
+        new otio::Timeline("benchmark"));
+    otio::SerializableObject::Retainer<otio::Track> track(
+        new otio::Track("V1"));
+    timeline->tracks()->append_child(track);
+    for (int i = 0; i < clip_count; ++i)
+    {
+        otio::AnyDictionary vendor;
+        vendor["tape"]   = std::string("A00") + std::to_string(i % 9);
+        vendor["reel"]   = int64_t(i);
+        vendor["gain"]   = 1.5;
+        vendor["locked"] = false;
+
+        otio::AnyDictionary metadata;
+        metadata["shot"]    = std::string("sh") + std::to_string(i);
+        metadata["version"] = int64_t(i % 7);
+        metadata["vendor"]  = vendor;
+        metadata["tags"]    = otio::AnyVector{ std::string("vfx"), 2.0 };
+        metadata["in"]      = otio::RationalTime(i, 24);
+        track->append_child(new otio::Clip(
+            "clip" + std::to_string(i),
+            new otio::ExternalReference(
+                "file:///media/clip" + std::to_string(i) + ".mov"),
+            otio::TimeRange(
+                otio::RationalTime(0, 24),
+                otio::RationalTime(48, 24)),
+            metadata));
+    }
+    return timeline;
+}
+
+static void
+BM_ToJsonString(benchmark::State& state)
+{
+    auto timeline = make_timeline(int(state.range(0)));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(timeline->to_json_string(nullptr, nullptr, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ToJsonString)->Arg(1)->Arg(100)->Arg(10000);
+
+static void
+BM_Clone(benchmark::State& state)
+{
+    auto timeline = make_timeline(int(state.range(0)));
+    for (auto _: state)
+    {
+        otio::SerializableObject::Retainer<> copy(timeline->clone());
+        benchmark::DoNotOptimize(copy.value);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Clone)->Arg(1)->Arg(100)->Arg(10000);
+
+static void
+BM_IsEquivalentTo(benchmark::State& state)
+{
+    auto timeline = make_timeline(int(state.range(0)));
+    auto other    = make_timeline(int(state.range(0)));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(timeline->is_equivalent_to(*other));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IsEquivalentTo)->Arg(1)->Arg(100)->Arg(10000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentime/rationalTimeArray.h"
+#include "opentime/timeRangeArray.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+namespace otime = opentime::OPENTIME_VERSION;
+
+static constexpr double ntsc_rate = 24000.0 / 1001.0;
+
+static std::vector<otime::TimeRange>
+make_ranges(size_t count)
+{
+    std::vector<otime::TimeRange> ranges(count);
+    otime::RationalTime           start(0, ntsc_rate);
+    for (size_t i = 0; i < count; ++i)
+    {
+        otime::RationalTime const duration(double(i % 48 + 1), ntsc_rate);
+        ranges[i] = otime::TimeRange(start, duration);
+        start     = ranges[i].end_time_exclusive();
+    }
+    return ranges;
+}
+
+static otime::TimeRangeArray
+make_range_array(std::vector<otime::TimeRange> const& ranges)
+{
+    otime::TimeRangeArray array;
+    array.reserve(ranges.size());
+    for (auto const& range: ranges)
+    {
+        array.push_back(range);
+    }
+    return array;
+}
+
+static void
+BM_RescaleScalar(benchmark::State& state)
+{
+    std::vector<otime::RationalTime> times;
+    for (auto const& range: make_ranges(size_t(state.range(0))))
+    {
+        times.push_back(range.start_time());
+    }
+    double rate = 48;
+    for (auto _: state)
+    {
+        for (auto& time: times)
+        {
+            time = time.rescaled_to(rate);
+        }
+        benchmark::DoNotOptimize(times.data());
+        rate = rate == 48 ? ntsc_rate : 48;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RescaleScalar)->Arg(100000);
+
+static void
+BM_RescaleArray(benchmark::State& state)
+{
+    otime::RationalTimeArray times =
+        make_range_array(make_ranges(size_t(state.range(0)))).start_times();
+    double rate = 48;
+    for (auto _: state)
+    {
+        times.rescale_to(rate);
+        benchmark::DoNotOptimize(times.values());
+        rate = rate == 48 ? ntsc_rate : 48;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RescaleArray)->Arg(100000);
+
+static void
+BM_ContainsScalar(benchmark::State& state)
+{
+    auto ranges = make_ranges(size_t(state.range(0)));
+    std::vector<uint8_t> result(ranges.size());
+    double               frame = 0;
+    for (auto _: state)
+    {
+        otime::RationalTime const playhead(frame, 24);
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            result[i] = ranges[i].contains(playhead);
+        }
+        benchmark::DoNotOptimize(result.data());
+        frame += 1;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ContainsScalar)->Arg(100000);
+
+static void
+BM_ContainsArray(benchmark::State& state)
+{
+    auto const array = make_range_array(make_ranges(size_t(state.range(0))));
+    std::vector<uint8_t> result(array.size());
+    double               frame = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            array.contains(otime::RationalTime(frame, 24), result.data()));
+        frame += 1;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ContainsArray)->Arg(100000);
+
+static void
+BM_IntersectsScalar(benchmark::State& state)
+{
+    auto ranges = make_ranges(size_t(state.range(0)));
+    std::vector<uint8_t> result(ranges.size());
+    otime::TimeRange const window(
+        otime::RationalTime(1000, 24),
+        otime::RationalTime(240, 24));
+    for (auto _: state)
+    {
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            result[i] = ranges[i].intersects(window);
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntersectsScalar)->Arg(100000);
+
+static void
+BM_IntersectsArray(benchmark::State& state)
+{
+    auto const array = make_range_array(make_ranges(size_t(state.range(0))));
+    std::vector<uint8_t>   result(array.size());
+    otime::TimeRange const window(
+        otime::RationalTime(1000, 24),
+        otime::RationalTime(240, 24));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(array.intersects(window, result.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntersectsArray)->Arg(100000);
+
+BENCHMARK_MAIN();
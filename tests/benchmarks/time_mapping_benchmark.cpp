@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/clip.h"
+#include "opentimelineio/stack.h"
+#include "opentimelineio/timeMapping.h"
+#include "opentimelineio/track.h"
+#include <benchmark/benchmark.h>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+// A stack of a track of state.range(0) clips, with the last clip holding a
+// nested stack of a track of one clip; times are mapped from the top stack
+// down to that innermost clip.
+struct Nested
+{
+    otio::SerializableObject::Retainer<otio::Stack> stack;
+    otio::SerializableObject::Retainer<otio::Clip>  leaf;
+};
+
+static Nested
+make_nested(benchmark::State const& state)
+{
+    otio::TimeRange const range(
+        otio::RationalTime(0, 24),
+        otio::RationalTime(48, 24));
+
+    Nested nested;
+    nested.stack     = new otio::Stack();
+    auto track       = new otio::Track();
+    auto inner       = new otio::Stack("inner", range);
+    auto inner_track = new otio::Track();
+    nested.leaf      = new otio::Clip("leaf", nullptr, range);
+
+    nested.stack->append_child(track);
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        track->append_child(new otio::Clip("clip", nullptr, range));
+    }
+    track->append_child(inner);
+    inner->append_child(inner_track);
+    inner_track->append_child(nested.leaf);
+    return nested;
+}
+
+static void
+BM_TransformedTime(benchmark::State& state)
+{
+    auto const         nested = make_nested(state);
+    otio::RationalTime time(0, 24);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            nested.stack->transformed_time(time, nested.leaf));
+    }
+}
+BENCHMARK(BM_TransformedTime)->Arg(10)->Arg(1000);
+
+static void
+BM_TimeMapping(benchmark::State& state)
+{
+    auto const         nested = make_nested(state);
+    otio::TimeMapping  mapping(nested.stack, nested.leaf);
+    otio::RationalTime time(0, 24);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(mapping.applied_to(time));
+    }
+}
+BENCHMARK(BM_TimeMapping)->Arg(10)->Arg(1000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentime/rationalTime.h"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace otime = opentime::OPENTIME_VERSION;
+
+static constexpr double ntsc_rate = 30000.0 / 1001.0;
+
+static std::vector<int64_t>
+make_frames(size_t count)
+{
+    std::vector<int64_t> frames(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        frames[i] = int64_t(i * 37);
+    }
+    return frames;
+}
+
+static void
+BM_ToTimecode(benchmark::State& state)
+{
+    auto frames = make_frames(size_t(state.range(0)));
+    for (auto _: state)
+    {
+        for (auto frame: frames)
+        {
+            benchmark::DoNotOptimize(
+                otime::RationalTime(double(frame), ntsc_rate)
+                    .to_timecode(ntsc_rate, otime::InferFromRate));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ToTimecode)->Arg(10000);
+
+static void
+BM_ToTimecodes(benchmark::State& state)
+{
+    auto        frames = make_frames(size_t(state.range(0)));
+    std::string buffer(frames.size() * otime::RationalTime::timecode_length, 0);
+    for (auto _: state)
+    {
+        otime::RationalTime::to_timecodes(
+            frames.data(),
+            frames.size(),
+            ntsc_rate,
+            otime::InferFromRate,
+            &buffer[0]);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ToTimecodes)->Arg(10000);
+
+static void
+BM_FromTimecode(benchmark::State& state)
+{
+    auto                     frames = make_frames(size_t(state.range(0)));
+    std::vector<std::string> timecodes;
+    for (auto frame: frames)
+    {
+        timecodes.push_back(otime::RationalTime(double(frame), ntsc_rate)
+                                .to_timecode(ntsc_rate, otime::InferFromRate));
+    }
+    for (auto _: state)
+    {
+        for (auto const& timecode: timecodes)
+        {
+            benchmark::DoNotOptimize(
+                otime::RationalTime::from_timecode(timecode, ntsc_rate));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FromTimecode)->Arg(10000);
+
+static void
+BM_FromTimecodes(benchmark::State& state)
+{
+    auto        frames = make_frames(size_t(state.range(0)));
+    std::string buffer(frames.size() * otime::RationalTime::timecode_length, 0);
+    otime::RationalTime::to_timecodes(
+        frames.data(),
+        frames.size(),
+        ntsc_rate,
+        otime::InferFromRate,
+        &buffer[0]);
+    for (auto _: state)
+    {
+        otime::RationalTime::from_timecodes(
+            buffer.data(),
+            frames.size(),
+            ntsc_rate,
+            frames.data());
+        benchmark::DoNotOptimize(frames.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FromTimecodes)->Arg(10000);
+
+BENCHMARK_MAIN();
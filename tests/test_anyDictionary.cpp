@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/anyDictionary.h>
+#include <opentimelineio/serializableObjectWithMetadata.h>
+
+#include <iostream>
+#include <string>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    tests.add_test("test_map_api", [] {
+        otio::AnyDictionary d{ { "b", 2 }, { "a", 1 }, { "c", 3 } };
+        assertEqual(d.size(), size_t(3));
+
+        // iteration is in key order
+        std::string keys;
+        for (auto const& e: d)
+        {
+            keys += e.first;
+        }
+        assertEqual(keys, std::string("abc"));
+
+        assertTrue(d.has_key("a"));
+        assertFalse(d.has_key("z"));
+        assertEqual(d.count("b"), size_t(1));
+        assertEqual(std::any_cast<int>(d.at("c")), 3);
+
+        auto inserted = d.insert({ "a", 10 });
+        assertFalse(inserted.second);
+        assertEqual(std::any_cast<int>(inserted.first->second), 1);
+
+        otio::AnyDictionary::value_type entry("bb", std::string("moved"));
+        auto hinted = d.insert(d.find("c"), std::move(entry));
+        assertEqual(hinted->first, std::string("bb"));
+        assertEqual(
+            std::any_cast<std::string>(hinted->second),
+            std::string("moved"));
+        assertEqual(d.erase("bb"), size_t(1));
+
+        assertTrue(d.emplace("d", 4).second);
+        d["e"] = std::string("five");
+        assertEqual(d.size(), size_t(5));
+        assertEqual(d.rbegin()->first, std::string("e"));
+        assertEqual(d.lower_bound("bb")->first, std::string("c"));
+        assertEqual(d.upper_bound("c")->first, std::string("d"));
+
+        int value = 0;
+        assertTrue(d.get_if_set("d", &value));
+        assertEqual(value, 4);
+
+        assertEqual(d.erase("b"), size_t(1));
+        assertEqual(d.erase("b"), size_t(0));
+        d.erase(d.find("a"));
+        assertEqual(d.begin()->first, std::string("c"));
+
+        otio::AnyDictionary other;
+        other.swap(d);
+        assertTrue(d.empty());
+        assertEqual(other.size(), size_t(3));
+    });
+
+    tests.add_test("test_mutation_stamp", [] {
+        otio::AnyDictionary d{ { "a", 1 } };
+        auto stamp = d.get_or_create_mutation_stamp();
+        int64_t start = stamp->stamp;
+
+        // updating an existing entry leaves iterators alone
+        d["a"] = 2;
+        d.insert({ "a", 3 });
+        assertEqual(stamp->stamp, start);
+
+        d.erase("a");
+        assertTrue(stamp->stamp > start);
+
+#if defined(OTIO_FLAT_ANY_DICTIONARY)
+        // with the flat storage, adding a key moves the other entries
+        start = stamp->stamp;
+        d.emplace("b", 1);
+        assertTrue(stamp->stamp > start);
+        start = stamp->stamp;
+        d["c"] = 2;
+        assertTrue(stamp->stamp > start);
+        start = stamp->stamp;
+        d.insert(d.end(), otio::AnyDictionary::value_type("d", 3));
+        assertTrue(stamp->stamp > start);
+#endif
+
+        start = stamp->stamp;
+        d.clear();
+        assertTrue(stamp->stamp > start);
+    });
+
+    tests.add_test("test_metadata_round_trip", [] {
+        otio::SerializableObject::Retainer<otio::SerializableObjectWithMetadata>
+            so = new otio::SerializableObjectWithMetadata("meta");
+        otio::AnyDictionary inner{ { "y", 2.5 }, { "x", int64_t(1) } };
+        so->metadata()["zeta"]  = std::string("last");
+        so->metadata()["alpha"] = inner;
+        so->metadata()["mid"]   = true;
+
+        otio::ErrorStatus err;
+        std::string       json = so->to_json_string(&err, nullptr, 0);
+        assertFalse(otio::is_error(err));
+        assertEqual(
+            json,
+            std::string(
+                R"({"OTIO_SCHEMA":"SerializableObjectWithMetadata.1",)"
+                R"("metadata":{"alpha":{"x":1,"y":2.5},"mid":true,"zeta":"last"},)"
+                R"("name":"meta"})"));
+
+        otio::SerializableObject::Retainer<> copy(
+            otio::SerializableObject::from_json_string(json, &err));
+        assertFalse(otio::is_error(err));
+        assertTrue(copy->is_equivalent_to(*so));
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/batchLoading.h>
+#include <opentimelineio/clip.h>
+#include <opentimelineio/timeline.h>
+#include <opentimelineio/track.h>
+
+#include <cerrno>
+#include <filesystem>
+#include <string>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+namespace fs   = std::filesystem;
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    tests.add_test("test_load_many", [] {
+        fs::path const root =
+            fs::temp_directory_path() / "otio_test_batch_loading";
+        fs::remove_all(root);
+        fs::create_directories(root);
+
+        // Timelines of different sizes, so that the threads finish out of
+        // order, and one path that does not exist.
+        std::vector<std::string> paths;
+        for (int i = 0; i < 12; ++i)
+        {
+            otio::SerializableObject::Retainer<otio::Timeline> timeline =
+                new otio::Timeline("timeline " + std::to_string(i));
+            auto track = new otio::Track();
+            timeline->tracks()->append_child(track);
+            for (int j = 0; j < (i % 3) * 100; ++j)
+            {
+                track->append_child(new otio::Clip("clip"));
+            }
+            std::string const path =
+                (root / ("timeline_" + std::to_string(i) + ".otio")).string();
+            assertTrue(timeline->to_json_file(path));
+            paths.push_back(path);
+        }
+        paths.insert(
+            paths.begin() + 5,
+            (root / "missing.otio").string());
+
+        auto const results = otio::load_many(paths, 4);
+        assertEqual(results.size(), paths.size());
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            auto const& result = results[i];
+            assertEqual(result.path, paths[i]);
+            if (i == 5)
+            {
+                assertTrue(otio::is_error(result.error_status));
+                assertEqual(
+                    result.error_status.outcome,
+                    otio::ErrorStatus::FILE_OPEN_FAILED);
+                assertEqual(result.error_number, ENOENT);
+                assertEqual(
+                    result.object.value,
+                    static_cast<otio::SerializableObject*>(nullptr));
+                continue;
+            }
+
+            int const index = int(i < 5 ? i : i - 1);
+            assertFalse(otio::is_error(result.error_status));
+            assertEqual(result.error_number, 0);
+            auto const timeline =
+                dynamic_cast<otio::Timeline*>(result.object.value);
+            assertTrue(timeline != nullptr);
+            assertEqual(
+                timeline->name(),
+                "timeline " + std::to_string(index));
+            assertEqual(
+                timeline->find_clips().size(),
+                size_t((index % 3) * 100));
+        }
+
+        assertEqual(otio::load_many({}).size(), size_t(0));
+        fs::remove_all(root);
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/externalReference.h>
+#include <opentimelineio/fileBundle.h>
+#include <opentimelineio/timeline.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+static std::string
+read_file(std::string const& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(
+        std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+}
+
+static void
+check_bundle(std::string const& path, bool directory)
+{
+    otio::FileBundle bundle;
+    otio::ErrorStatus err;
+    assertTrue(bundle.open(path, &err));
+    assertFalse(otio::is_error(err));
+    assertTrue(bundle.is_open());
+    assertEqual(bundle.is_directory(), directory);
+    assertEqual(bundle.version(&err), std::string("1.0.0"));
+
+    otio::SerializableObject::Retainer<otio::Timeline> timeline(
+        dynamic_cast<otio::Timeline*>(bundle.read_content(&err)));
+    assertFalse(otio::is_error(err));
+    assertNotNull(timeline.value);
+    assertEqual(timeline->name(), std::string("bundle_example"));
+
+    auto clips = timeline->find_clips();
+    assertEqual(clips.size(), size_t(2));
+    auto ref = dynamic_cast<otio::ExternalReference*>(
+        clips[0]->media_reference());
+    assertNotNull(ref);
+    assertEqual(
+        ref->target_url(),
+        std::string("media/OpenTimelineIO@3xDark.png"));
+
+    auto entries = bundle.media_entries();
+    assertEqual(entries.size(), size_t(3));
+    assertEqual(entries[0].name, std::string("media/OpenTimelineIO@3xDark.png"));
+    assertEqual(entries[2].name, std::string("media/notes.txt"));
+    assertFalse(entries[0].compressed);
+
+    // Every media entry must match the file it was bundled from.
+    for (auto const& entry: entries)
+    {
+        assertTrue(bundle.has_media(entry.name));
+        auto data = bundle.media_data(entry.name, &err);
+        assertFalse(otio::is_error(err));
+        assertEqual(data.size(), size_t(entry.size));
+
+        std::string original = read_file(
+            directory ? path + "/" + entry.name
+                      : "sample_data/bundle_example.otiod/" + entry.name);
+        assertTrue(data == original);
+    }
+
+    // Views are stable across repeated lookups.
+    auto first  = bundle.media_data("media/notes.txt");
+    auto second = bundle.media_data("media/notes.txt");
+    assertEqual(
+        static_cast<void const*>(first.data()),
+        static_cast<void const*>(second.data()));
+
+    assertFalse(bundle.has_media("media/missing.png"));
+    assertFalse(bundle.has_media("content.otio"));
+    assertFalse(bundle.has_media("media/../content.otio"));
+
+    err = otio::ErrorStatus();
+    auto missing = bundle.media_data("media/missing.png", &err);
+    assertTrue(missing.empty());
+    assertTrue(otio::is_error(err));
+
+    bundle.close();
+    assertFalse(bundle.is_open());
+    assertTrue(bundle.media_entries().empty());
+}
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    tests.add_test("test_read_otioz", [] {
+        check_bundle("sample_data/bundle_example.otioz", false);
+    });
+
+    tests.add_test("test_read_otiod", [] {
+        check_bundle("sample_data/bundle_example.otiod", true);
+    });
+
+    tests.add_test("test_open_errors", [] {
+        otio::FileBundle  bundle;
+        otio::ErrorStatus err;
+        assertFalse(bundle.open("sample_data/no_such_bundle.otioz", &err));
+        assertEqual(err.outcome, otio::ErrorStatus::FILE_OPEN_FAILED);
+        assertFalse(bundle.is_open());
+
+        // A plain JSON file is not a zip archive.
+        err = otio::ErrorStatus();
+        assertFalse(bundle.open("sample_data/simple_cut.otio", &err));
+        assertEqual(err.outcome, otio::ErrorStatus::MALFORMED_BUNDLE);
+
+        err = otio::ErrorStatus();
+        assertEqual(bundle.read_content(&err), (otio::SerializableObject*) nullptr);
+        assertTrue(otio::is_error(err));
+    });
+
+    tests.add_test("test_truncated_zip64", [] {
+        // A zip64 locator and an end of central directory record that
+        // defers to it, with nothing else: too small to hold any zip64
+        // record, wherever the locator points.
+        std::string const data(
+            "PK\x06\x07"
+            "\x00\x00\x00\x00"
+            "\x00\x00\x00\x00\x10\x00\x00\x00"
+            "\x01\x00\x00\x00"
+            "PK\x05\x06"
+            "\x00\x00\x00\x00"
+            "\xff\xff\xff\xff"
+            "\xff\xff\xff\xff"
+            "\xff\xff\xff\xff"
+            "\x00\x00",
+            42);
+        std::string const path = "truncated_zip64.otioz";
+        {
+            std::ofstream out(path, std::ios::binary);
+            out << data;
+        }
+
+        otio::FileBundle  bundle;
+        otio::ErrorStatus err;
+        bool const        opened = bundle.open(path, &err);
+        std::remove(path.c_str());
+        assertFalse(opened);
+        assertEqual(err.outcome, otio::ErrorStatus::MALFORMED_BUNDLE);
+    });
+
+    tests.add_test("test_forged_entry_size", [] {
+        std::string const original =
+            read_file("sample_data/bundle_example.otioz");
+
+        // Rewrite the uncompressed size of an entry in the central
+        // directory.
+        auto const forge = [&](std::string const& name, uint32_t size) {
+            std::string data = original;
+            for (size_t i = data.find("PK\x01\x02"); i != std::string::npos;
+                 i = data.find("PK\x01\x02", i + 4))
+            {
+                if (data.compare(i + 46, name.size(), name) == 0)
+                {
+                    for (int b = 0; b < 4; ++b)
+                    {
+                        data[i + 24 + b] = char((size >> (8 * b)) & 0xff);
+                    }
+                }
+            }
+            std::string const path = "forged_size.otioz";
+            std::ofstream(path, std::ios::binary) << data;
+            return path;
+        };
+
+        // content.otio is 516 bytes deflated: it cannot hold 4 GB.
+        {
+            std::string const path = forge("content.otio", 0xf0000000);
+            otio::FileBundle  bundle;
+            otio::ErrorStatus err;
+            assertTrue(bundle.open(path, &err));
+            otio::SerializableObject::Retainer<> content(
+                bundle.read_content(&err));
+            std::remove(path.c_str());
+            assertEqual(
+                content.value,
+                static_cast<otio::SerializableObject*>(nullptr));
+            assertEqual(err.outcome, otio::ErrorStatus::MALFORMED_BUNDLE);
+        }
+
+        // A plausible size that is not the real one.
+        {
+            std::string const path = forge("media/notes.txt", 721);
+            otio::FileBundle  bundle;
+            otio::ErrorStatus err;
+            assertTrue(bundle.open(path, &err));
+            auto const data = bundle.media_data("media/notes.txt", &err);
+            std::remove(path.c_str());
+            assertTrue(data.empty());
+            assertEqual(err.outcome, otio::ErrorStatus::MALFORMED_BUNDLE);
+        }
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/frozenTimeline.h>
+#include <opentimelineio/gap.h>
+#include <opentimelineio/marker.h>
+#include <opentimelineio/timeline.h>
+#include <opentimelineio/track.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+namespace {
+
+otio::TimeRange
+frames(double start, double duration, double rate = 24)
+{
+    return otio::TimeRange(
+        otio::RationalTime(start, rate),
+        otio::RationalTime(duration, rate));
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    // video
+    //   gap    [0, 10)
+    //   clip_0 [10, 20) ... clip_49 [500, 510)
+    using otio::SerializableObject;
+    SerializableObject::Retainer<otio::Timeline> timeline =
+        new otio::Timeline("timeline", otio::RationalTime(86400, 24));
+    SerializableObject::Retainer<otio::Track> video = new otio::Track("video");
+    timeline->tracks()->append_child(video);
+    video->append_child(new otio::Gap(frames(0, 10)));
+    for (int i = 0; i < 50; ++i)
+    {
+        auto clip =
+            new otio::Clip("clip_" + std::to_string(i), nullptr, frames(i, 10));
+        clip->markers().push_back(new otio::Marker("marker"));
+        video->append_child(clip);
+    }
+
+    tests.add_test("test_freeze", [&] {
+        otio::ErrorStatus err;
+        auto const        frozen = otio::FrozenTimeline::freeze(timeline, &err);
+        assertFalse(otio::is_error(err));
+        assertTrue(frozen != nullptr);
+
+        // The frozen timeline is a copy.
+        assertTrue(frozen->timeline() != timeline.value);
+        assertEqual(frozen->timeline()->name(), std::string("timeline"));
+        assertEqual(frozen->clips().size(), size_t(50));
+        assertEqual(frozen->clips()[3]->name(), std::string("clip_3"));
+        assertEqual(frozen->structure().size(), size_t(53));
+        assertEqual(frozen->schedule().entries().size(), size_t(50));
+
+        auto const clip  = frozen->clips()[3];
+        auto const range = frozen->range_of(clip);
+        assertTrue(range.has_value());
+        assertEqual(*range, frames(40, 10));
+        assertEqual(
+            frozen->structure().object(frozen->row_of(clip)),
+            static_cast<otio::Composable const*>(clip));
+
+        // Objects of the original are not in the frozen copy.
+        assertEqual(frozen->row_of(video), int64_t(-1));
+        assertFalse(frozen->range_of(video).has_value());
+
+        // Editing the original does not change the frozen copy.
+        video->children()[1]->set_name("renamed");
+        video->append_child(new otio::Gap(frames(0, 10)));
+        assertEqual(frozen->clips()[0]->name(), std::string("clip_0"));
+        assertEqual(frozen->structure().size(), size_t(53));
+        video->children()[1]->set_name("clip_0");
+        video->remove_child(int(video->children().size()) - 1);
+    });
+
+    tests.add_test("test_concurrent_queries", [&] {
+        auto const frozen = otio::FrozenTimeline::freeze(timeline);
+        assertTrue(frozen != nullptr);
+
+        std::atomic<int>         mismatches(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([&frozen, &mismatches] {
+                for (int pass = 0; pass < 20; ++pass)
+                {
+                    for (auto clip: frozen->clips())
+                    {
+                        otio::ErrorStatus err;
+                        auto const        expected =
+                            clip->range_in_parent(&err);
+                        auto const range = frozen->range_of(clip);
+                        if (otio::is_error(err) || !range
+                            || *range != expected
+                            || clip->schema_name() != "Clip"
+                            || clip->markers().size() != 1)
+                        {
+                            ++mismatches;
+                        }
+                    }
+                    auto const time = otio::RationalTime(86400 + 45, 24);
+                    std::vector<otio::PlaybackSchedule::Entry const*> found;
+                    frozen->schedule().entries_at(time, found);
+                    if (found.size() != 1
+                        || found[0]->clip != frozen->clips()[3])
+                    {
+                        ++mismatches;
+                    }
+                }
+            });
+        }
+        for (auto& thread: threads)
+        {
+            thread.join();
+        }
+        assertEqual(mismatches.load(), 0);
+    });
+
+    tests.add_test("test_freeze_null", [] {
+        otio::ErrorStatus err;
+        auto const        frozen = otio::FrozenTimeline::freeze(nullptr, &err);
+        assertTrue(frozen == nullptr);
+        assertTrue(otio::is_error(err));
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/imageSequenceReference.h>
+
+#include <string>
+#include <vector>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+
+using otio::RationalTime;
+using otio::TimeRange;
+
+// Every other frame of a 24 fps render, so 24 images over the two seconds
+// of the available range, numbered from frame 1.
+static otio::SerializableObject::Retainer<otio::ImageSequenceReference>
+make_reference(otio::ImageSequenceReference::MissingFramePolicy policy)
+{
+    return new otio::ImageSequenceReference(
+        "file:///show/seq/shot/rndr",
+        "show_shot.",
+        ".exr",
+        1,
+        2,
+        24,
+        4,
+        policy,
+        TimeRange(RationalTime(12, 24), RationalTime(48, 24)));
+}
+
+// The range of count images from image first, which may be outside of the
+// sequence.
+static TimeRange
+images(int first, int count)
+{
+    return TimeRange(
+        RationalTime(12 + first * 2, 24),
+        RationalTime(count * 2, 24));
+}
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    tests.add_test("test_image_numbers_in_range", [] {
+        auto const ref = make_reference(
+            otio::ImageSequenceReference::MissingFramePolicy::error);
+        assertEqual(ref->number_of_images_in_sequence(), 24);
+
+        std::vector<int> numbers;
+        otio::ErrorStatus err;
+        assertTrue(ref->image_numbers_in_range(
+            ref->available_range().value(),
+            numbers,
+            &err));
+        assertFalse(otio::is_error(err));
+        assertEqual(numbers.size(), size_t(24));
+        for (int i = 0; i < 24; ++i)
+        {
+            assertEqual(numbers[i], i);
+        }
+
+        // A frame step of 2 puts each image two frames after the last.
+        assertTrue(ref->image_numbers_in_range(images(2, 3), numbers, &err));
+        assertEqual(numbers, std::vector<int>({ 2, 3, 4 }));
+
+        // An image is in the range when it starts within it.
+        assertTrue(ref->image_numbers_in_range(
+            TimeRange(RationalTime(17, 24), RationalTime(4, 24)),
+            numbers,
+            &err));
+        assertEqual(numbers, std::vector<int>({ 3, 4 }));
+    });
+
+    tests.add_test("test_missing_frame_policies", [] {
+        using Policy = otio::ImageSequenceReference::MissingFramePolicy;
+
+        std::vector<int> numbers;
+        otio::ErrorStatus err;
+
+        auto const hold = make_reference(Policy::hold);
+        assertTrue(hold->image_numbers_in_range(images(-2, 4), numbers, &err));
+        assertEqual(numbers, std::vector<int>({ 0, 0, 0, 1 }));
+        assertTrue(hold->image_numbers_in_range(images(22, 4), numbers, &err));
+        assertEqual(numbers, std::vector<int>({ 22, 23, 23, 23 }));
+
+        auto const black = make_reference(Policy::black);
+        assertTrue(black->image_numbers_in_range(images(-2, 4), numbers, &err));
+        assertEqual(numbers, std::vector<int>({ -1, -1, 0, 1 }));
+        assertTrue(black->image_numbers_in_range(images(22, 4), numbers, &err));
+        assertEqual(numbers, std::vector<int>({ 22, 23, -1, -1 }));
+
+        // With error, nothing is produced.
+        auto const error = make_reference(Policy::error);
+        for (auto const& range: { images(-2, 4), images(22, 4) })
+        {
+            numbers = { 7 };
+            err     = otio::ErrorStatus();
+            assertFalse(error->image_numbers_in_range(range, numbers, &err));
+            assertEqual(err.outcome, otio::ErrorStatus::ILLEGAL_INDEX);
+            assertTrue(numbers.empty());
+
+            std::vector<std::string> urls = { "stale" };
+            err                           = otio::ErrorStatus();
+            assertFalse(error->target_urls_in_range(range, urls, &err));
+            assertEqual(err.outcome, otio::ErrorStatus::ILLEGAL_INDEX);
+            assertTrue(urls.empty());
+
+            int calls = 0;
+            err       = otio::ErrorStatus();
+            assertFalse(error->for_each_target_url_in_range(
+                range,
+                [&](int, std::string const&) { ++calls; },
+                &err));
+            assertEqual(err.outcome, otio::ErrorStatus::ILLEGAL_INDEX);
+            assertEqual(calls, 0);
+        }
+    });
+
+    tests.add_test("test_target_urls_in_range", [] {
+        using Policy = otio::ImageSequenceReference::MissingFramePolicy;
+
+        auto const ref = make_reference(Policy::error);
+        std::vector<std::string> urls;
+        otio::ErrorStatus        err;
+        assertTrue(ref->target_urls_in_range(
+            ref->available_range().value(),
+            urls,
+            &err));
+        assertFalse(otio::is_error(err));
+        assertEqual(urls.size(), size_t(24));
+        assertEqual(
+            urls.front(),
+            std::string("file:///show/seq/shot/rndr/show_shot.0001.exr"));
+        for (int i = 0; i < 24; ++i)
+        {
+            assertEqual(urls[i], ref->target_url_for_image_number(i));
+        }
+
+        std::vector<std::pair<int, std::string>> visited;
+        assertTrue(ref->for_each_target_url_in_range(
+            images(20, 4),
+            [&](int image_number, std::string const& url) {
+                visited.emplace_back(image_number, url);
+            },
+            &err));
+        assertEqual(visited.size(), size_t(4));
+        for (int i = 0; i < 4; ++i)
+        {
+            assertEqual(visited[i].first, 20 + i);
+            assertEqual(visited[i].second, urls[20 + i]);
+        }
+
+        // The URL of a black frame is empty.
+        auto const black = make_reference(Policy::black);
+        assertTrue(black->target_urls_in_range(images(22, 4), urls, &err));
+        assertEqual(
+            urls,
+            std::vector<std::string>(
+                { black->target_url_for_image_number(22),
+                  black->target_url_for_image_number(23),
+                  std::string(),
+                  std::string() }));
+    });
+
+    tests.add_test("test_target_urls_in_range_reuses_strings", [] {
+        auto const ref = make_reference(
+            otio::ImageSequenceReference::MissingFramePolicy::error);
+
+        std::vector<std::string> urls;
+        assertTrue(ref->target_urls_in_range(images(0, 8), urls));
+        std::string const* const storage = urls.data();
+        std::vector<char const*> buffers;
+        for (auto const& url: urls)
+        {
+            buffers.push_back(url.data());
+        }
+
+        // Refilling with as many URLs of the same length keeps both the
+        // vector and each string's buffer.
+        assertTrue(ref->target_urls_in_range(images(8, 8), urls));
+        assertEqual(urls.data(), storage);
+        for (size_t i = 0; i < urls.size(); ++i)
+        {
+            assertEqual(urls[i].data(), buffers[i]);
+            assertEqual(
+                urls[i],
+                ref->target_url_for_image_number(int(8 + i)));
+        }
+
+        // Fewer URLs shrink the vector.
+        assertTrue(ref->target_urls_in_range(images(16, 3), urls));
+        assertEqual(urls.size(), size_t(3));
+        assertEqual(urls.data(), storage);
+        assertEqual(urls[2], ref->target_url_for_image_number(18));
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
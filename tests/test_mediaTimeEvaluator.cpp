@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/freezeFrame.h>
+#include <opentimelineio/gap.h>
+#include <opentimelineio/linearTimeWarp.h>
+#include <opentimelineio/mediaTimeEvaluator.h>
+#include <opentimelineio/stack.h>
+#include <opentimelineio/timeline.h>
+#include <opentimelineio/track.h>
+
+#include <iostream>
+
+namespace otime = opentime::OPENTIME_VERSION;
+namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
+
+namespace {
+
+otio::TimeRange
+frames(double start, double duration)
+{
+    return otio::TimeRange(
+        otio::RationalTime(start, 24),
+        otio::RationalTime(duration, 24));
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    // video
+    //   gap    [0, 10)
+    //   clip_a [10, 30)  source 100-120
+    //   clip_b [30, 40)  source 0-10, at double speed
+    //   nested [40, 60)  source 5-25 of
+    //     track
+    //       clip_c       source 50-80
+    //     track
+    //       gap          [0, 10)
+    //       clip_d       source 200-205
+    // overlay
+    //   clip_e [0, 5)    source 7-12, frozen
+    //   clip_f [5, 10)   disabled
+    using otio::SerializableObject;
+    SerializableObject::Retainer<otio::Timeline> timeline = new otio::Timeline();
+    SerializableObject::Retainer<otio::Track>    video    = new otio::Track();
+    SerializableObject::Retainer<otio::Track>    overlay  = new otio::Track();
+    SerializableObject::Retainer<otio::Clip>     clip_a =
+        new otio::Clip("a", nullptr, frames(100, 20));
+    SerializableObject::Retainer<otio::Clip> clip_b =
+        new otio::Clip("b", nullptr, frames(0, 10));
+    SerializableObject::Retainer<otio::Stack> nested =
+        new otio::Stack("nested", frames(5, 20));
+    SerializableObject::Retainer<otio::Track> lower = new otio::Track();
+    SerializableObject::Retainer<otio::Track> upper = new otio::Track();
+    SerializableObject::Retainer<otio::Clip>  clip_c =
+        new otio::Clip("c", nullptr, frames(50, 30));
+    SerializableObject::Retainer<otio::Clip> clip_d =
+        new otio::Clip("d", nullptr, frames(200, 5));
+    SerializableObject::Retainer<otio::Clip> clip_e =
+        new otio::Clip("e", nullptr, frames(7, 5));
+    SerializableObject::Retainer<otio::Clip> clip_f =
+        new otio::Clip("f", nullptr, frames(0, 5));
+
+    timeline->tracks()->append_child(video);
+    timeline->tracks()->append_child(overlay);
+    video->append_child(new otio::Gap(frames(0, 10)));
+    video->append_child(clip_a);
+    clip_b->effects().push_back(new otio::LinearTimeWarp("warp", "", 2));
+    video->append_child(clip_b);
+    video->append_child(nested);
+    nested->append_child(lower);
+    nested->append_child(upper);
+    lower->append_child(clip_c);
+    upper->append_child(new otio::Gap(frames(0, 10)));
+    upper->append_child(clip_d);
+    clip_e->effects().push_back(new otio::FreezeFrame());
+    overlay->append_child(clip_e);
+    clip_f->set_enabled(false);
+    overlay->append_child(clip_f);
+
+    tests.add_test("test_evaluate", [&] {
+        otio::MediaTimeEvaluator evaluator(timeline);
+        assertEqual(evaluator.track_count(), size_t(2));
+
+        // which clip is showing, and the frame of its media
+        struct Expected
+        {
+            double            frame;
+            otio::Clip const* clip;
+            double            media_frame;
+        };
+        Expected const video_frames[] = {
+            { 0, nullptr, 0 },  { 9.5, nullptr, 0 }, { 10, clip_a, 100 },
+            { 29, clip_a, 119 }, { 30, clip_b, 0 },   { 33.5, clip_b, 7 },
+            { 40, clip_c, 55 },  { 44, clip_c, 59 },  { 45, clip_d, 200 },
+            { 49, clip_d, 204 }, { 50, clip_c, 65 },  { 59, clip_c, 74 },
+            { 60, nullptr, 0 },
+        };
+        for (auto const& expected: video_frames)
+        {
+            otio::RationalTime const time(expected.frame, 24);
+            otio::ErrorStatus        err;
+            auto const               result = evaluator.evaluate(0, time, &err);
+            assertFalse(otio::is_error(err));
+            assertEqual(result.clip, expected.clip);
+            if (expected.clip)
+            {
+                assertEqual(
+                    result.media_time,
+                    otio::RationalTime(expected.media_frame, 24));
+                assertEqual(
+                    result.media_reference,
+                    static_cast<otio::MediaReference const*>(
+                        expected.clip->media_reference()));
+            }
+            if (expected.clip && expected.clip != clip_b)
+            {
+                assertEqual(
+                    result.media_time,
+                    timeline->tracks()->transformed_time(time, expected.clip));
+            }
+        }
+
+        // a frozen clip holds its first frame, and a disabled one is not
+        // shown
+        auto const frozen = evaluator.evaluate(otio::RationalTime(3, 24));
+        assertEqual(frozen.size(), size_t(2));
+        assertEqual(frozen[1].clip, static_cast<otio::Clip const*>(clip_e));
+        assertEqual(frozen[1].media_time, otio::RationalTime(7, 24));
+        assertEqual(
+            evaluator.evaluate(1, otio::RationalTime(7, 24)).clip,
+            static_cast<otio::Clip const*>(nullptr));
+
+        // times at other rates
+        assertEqual(
+            evaluator.evaluate(0, otio::RationalTime(20 * 48 / 24, 48))
+                .media_time,
+            otio::RationalTime(110, 24));
+
+        otio::ErrorStatus err;
+        evaluator.evaluate(2, otio::RationalTime(), &err);
+        assertEqual(err.outcome, otio::ErrorStatus::ILLEGAL_INDEX);
+    });
+
+    tests.add_test("test_evaluate_batch", [&] {
+        otio::MediaTimeEvaluator    evaluator(timeline);
+        otime::RationalTimeArray    times;
+        for (double frame = -2; frame < 64; frame += 0.5)
+        {
+            times.push_back(otio::RationalTime(frame, 24));
+        }
+        // and some out of order
+        for (double frame: { 50.0, 12.0, 47.0, 61.0, 3.0, 41.0 })
+        {
+            times.push_back(otio::RationalTime(frame, 24));
+        }
+
+        for (size_t track = 0; track < 2; ++track)
+        {
+            auto const batch = evaluator.evaluate(track, times);
+            assertEqual(batch.clips.size(), times.size());
+            assertEqual(batch.media_times.size(), times.size());
+            for (size_t i = 0; i < times.size(); ++i)
+            {
+                auto const result = evaluator.evaluate(track, times[i]);
+                assertEqual(batch.clips[i], result.clip);
+                assertEqual(batch.media_references[i], result.media_reference);
+                if (result.clip)
+                {
+                    assertEqual(batch.media_times[i], result.media_time);
+                }
+            }
+        }
+    });
+
+    tests.add_test("test_recompiles_after_edits", [&] {
+        otio::MediaTimeEvaluator evaluator(timeline);
+        otio::RationalTime const time(47, 24);
+        assertEqual(
+            evaluator.evaluate(0, time).clip,
+            static_cast<otio::Clip const*>(clip_d));
+        assertTrue(evaluator.is_current());
+
+        clip_d->set_enabled(false);
+        assertFalse(evaluator.is_current());
+        auto result = evaluator.evaluate(0, time);
+        assertEqual(result.clip, static_cast<otio::Clip const*>(clip_c));
+        assertEqual(result.media_time, otio::RationalTime(62, 24));
+        clip_d->set_enabled(true);
+
+        clip_a->set_source_range(frames(300, 20));
+        assertEqual(
+            evaluator.evaluate(0, otio::RationalTime(15, 24)).media_time,
+            otio::RationalTime(305, 24));
+        clip_a->set_source_range(frames(100, 20));
+
+        // changing an effect needs an explicit invalidate()
+        auto warp =
+            dynamic_cast<otio::LinearTimeWarp*>(clip_b->effects()[0].value);
+        warp->set_time_scalar(3);
+        evaluator.invalidate();
+        assertEqual(
+            evaluator.evaluate(0, otio::RationalTime(32, 24)).media_time,
+            otio::RationalTime(6, 24));
+        warp->set_time_scalar(2);
+
+        SerializableObject::Retainer<otio::Stack> replacement = new otio::Stack();
+        SerializableObject::Retainer<otio::Stack> original = timeline->tracks();
+        timeline->set_tracks(replacement);
+        assertFalse(evaluator.is_current());
+        assertEqual(evaluator.track_count(), size_t(0));
+        timeline->set_tracks(original);
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/externalReference.h>
+#include <opentimelineio/imageSequenceReference.h>
+#include <opentimelineio/mediaVerification.h>
+#include <opentimelineio/missingReference.h>
+#include <opentimelineio/timeline.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace otio = opentimelineio::OPENTIMELINEIO_VERSION;
+namespace fs   = std::filesystem;
+
+static void
+write_file(fs::path const& path, std::string const& contents)
+{
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+}
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    tests.add_test("test_filepath_from_url", [] {
+        assertEqual(
+            otio::filepath_from_url("file:///show/shot/a%20b.exr"),
+            std::string("/show/shot/a b.exr"));
+        assertEqual(
+            otio::filepath_from_url("file://localhost/show/a.exr"),
+            std::string("/show/a.exr"));
+        assertEqual(
+            otio::filepath_from_url("file://server/share/a.exr"),
+            std::string("//server/share/a.exr"));
+        assertEqual(
+            otio::filepath_from_url("file:///C:/show/a.exr"),
+            std::string("C:/show/a.exr"));
+        assertEqual(
+            otio::filepath_from_url("media/a.exr"),
+            std::string("media/a.exr"));
+        assertEqual(
+            otio::filepath_from_url("C:/show/a.exr"),
+            std::string("C:/show/a.exr"));
+        assertEqual(
+            otio::filepath_from_url("https://example.com/a.exr"),
+            std::string());
+    });
+
+    tests.add_test("test_verify_media", [] {
+        fs::path const root =
+            fs::temp_directory_path() / "otio_test_media_verification";
+        fs::remove_all(root);
+        fs::create_directories(root / "frames");
+        write_file(root / "movie.mov", "movie");
+
+        // Images 1001 to 1010, with 1004 and 1005 missing and 1009 empty.
+        for (int frame = 1001; frame <= 1010; ++frame)
+        {
+            if (frame != 1004 && frame != 1005)
+            {
+                std::string const name =
+                    "shot." + std::to_string(frame) + ".exr";
+                write_file(
+                    root / "frames" / name,
+                    frame == 1009 ? "" : "image");
+            }
+        }
+
+        using otio::SerializableObject;
+        SerializableObject::Retainer<otio::Timeline> timeline =
+            new otio::Timeline();
+        otio::Track* track = new otio::Track();
+        timeline->tracks()->append_child(track);
+
+        otio::TimeRange const range(
+            otio::RationalTime(0, 24),
+            otio::RationalTime(10, 24));
+        track->append_child(new otio::Clip(
+            "movie",
+            new otio::ExternalReference("movie.mov", range)));
+        track->append_child(new otio::Clip(
+            "missing",
+            new otio::ExternalReference(
+                "file://" + (root / "gone.mov").string(),
+                range)));
+        track->append_child(new otio::Clip(
+            "remote",
+            new otio::ExternalReference("https://example.com/a.mov", range)));
+        track->append_child(new otio::Clip(
+            "offline",
+            new otio::MissingReference()));
+        auto sequence = new otio::ImageSequenceReference(
+            "file://" + (root / "frames").string(),
+            "shot.",
+            ".exr",
+            1001,
+            1,
+            24,
+            4,
+            otio::ImageSequenceReference::MissingFramePolicy::error,
+            range);
+        track->append_child(new otio::Clip("frames", sequence));
+        // only shows images 6 to 8
+        track->append_child(new otio::Clip(
+            "tail",
+            sequence,
+            otio::TimeRange(
+                otio::RationalTime(6, 24),
+                otio::RationalTime(3, 24))));
+
+        for (size_t threshold: { size_t(1), size_t(100) })
+        {
+            otio::MediaVerificationOptions options;
+            options.base_path         = root.string();
+            options.listing_threshold = threshold;
+            options.thread_count      = 3;
+
+            otio::ErrorStatus err;
+            auto const reports = otio::verify_media(timeline, options, &err);
+            assertFalse(otio::is_error(err));
+            assertEqual(reports.size(), size_t(6));
+
+            assertEqual(reports[0].status, otio::MediaVerificationReport::ok);
+            assertEqual(reports[0].size, uint64_t(5));
+            assertEqual(
+                reports[0].path,
+                (root / "movie.mov").lexically_normal().string());
+            assertEqual(
+                reports[1].status,
+                otio::MediaVerificationReport::missing);
+            assertEqual(
+                reports[2].status,
+                otio::MediaVerificationReport::unsupported_url);
+            assertEqual(
+                reports[3].status,
+                otio::MediaVerificationReport::not_checked);
+
+            auto const& frames = reports[4];
+            assertEqual(
+                frames.status,
+                otio::MediaVerificationReport::incomplete);
+            assertEqual(frames.image_count, size_t(10));
+            assertEqual(frames.size, uint64_t(7 * 5));
+            assertEqual(frames.missing_images.size(), size_t(2));
+            assertEqual(frames.missing_images[0].first, 3);
+            assertEqual(frames.missing_images[0].second, 4);
+            assertEqual(frames.missing_images[1].first, 8);
+            assertEqual(frames.missing_images[1].second, 8);
+            assertTrue(frames.violates_missing_frame_policy);
+
+            auto const& tail = reports[5];
+            assertEqual(tail.image_count, size_t(3));
+            assertEqual(tail.missing_images.size(), size_t(1));
+            assertEqual(tail.missing_images[0].first, 8);
+        }
+
+        sequence->set_missing_frame_policy(
+            otio::ImageSequenceReference::MissingFramePolicy::hold);
+        otio::MediaVerificationOptions options;
+        options.base_path  = root.string();
+        options.read_sizes = false;
+        auto const reports = otio::verify_media(timeline, options);
+        assertFalse(reports[4].violates_missing_frame_policy);
+        assertEqual(reports[4].missing_images.size(), size_t(1));
+        assertEqual(reports[4].size, uint64_t(0));
+
+        fs::remove_all(root);
+    });
+
+    tests.add_test("test_verify_media_outside_available_range", [] {
+        fs::path const root =
+            fs::temp_directory_path() / "otio_test_media_verification_range";
+        fs::remove_all(root);
+        fs::create_directories(root);
+        for (int frame = 1; frame <= 4; ++frame)
+        {
+            write_file(
+                root / ("shot." + std::to_string(frame) + ".exr"),
+                "image");
+        }
+
+        using otio::SerializableObject;
+        SerializableObject::Retainer<otio::Timeline> timeline =
+            new otio::Timeline();
+        otio::Track* track = new otio::Track();
+        timeline->tracks()->append_child(track);
+
+        // Images 1 to 4 over frames 10 to 13.
+        auto sequence = new otio::ImageSequenceReference(
+            "file://" + root.string(),
+            "shot.",
+            ".exr",
+            1,
+            1,
+            24,
+            0,
+            otio::ImageSequenceReference::MissingFramePolicy::error,
+            otio::TimeRange(
+                otio::RationalTime(10, 24),
+                otio::RationalTime(4, 24)));
+        // frames 8 to 15, two either side of the sequence
+        track->append_child(new otio::Clip(
+            "wide",
+            sequence,
+            otio::TimeRange(
+                otio::RationalTime(8, 24),
+                otio::RationalTime(8, 24))));
+        // frames 20 to 21, all after the sequence
+        track->append_child(new otio::Clip(
+            "after",
+            sequence,
+            otio::TimeRange(
+                otio::RationalTime(20, 24),
+                otio::RationalTime(2, 24))));
+        track->append_child(new otio::Clip(
+            "unavailable",
+            new otio::ImageSequenceReference("file://" + root.string())));
+
+        auto reports = otio::verify_media(timeline);
+        assertEqual(reports.size(), size_t(3));
+
+        auto const& wide = reports[0];
+        assertEqual(wide.status, otio::MediaVerificationReport::incomplete);
+        assertEqual(wide.image_count, size_t(8));
+        assertEqual(wide.size, uint64_t(4 * 5));
+        assertEqual(
+            wide.missing_images,
+            (std::vector<std::pair<int, int>>{ { -2, -1 }, { 4, 5 } }));
+        assertTrue(wide.violates_missing_frame_policy);
+
+        auto const& after = reports[1];
+        assertEqual(after.status, otio::MediaVerificationReport::missing);
+        assertEqual(after.image_count, size_t(2));
+        assertEqual(
+            after.missing_images,
+            (std::vector<std::pair<int, int>>{ { 10, 11 } }));
+        assertTrue(after.violates_missing_frame_policy);
+
+        assertEqual(
+            reports[2].status,
+            otio::MediaVerificationReport::invalid_range);
+
+        // Hold shows the first and last images in place of the others, and
+        // black shows nothing.
+        for (auto policy:
+             { otio::ImageSequenceReference::MissingFramePolicy::hold,
+               otio::ImageSequenceReference::MissingFramePolicy::black })
+        {
+            sequence->set_missing_frame_policy(policy);
+            reports = otio::verify_media(timeline);
+            assertEqual(reports[0].status, otio::MediaVerificationReport::ok);
+            assertEqual(reports[0].image_count, size_t(4));
+            assertTrue(reports[0].missing_images.empty());
+            assertFalse(reports[0].violates_missing_frame_policy);
+        }
+        assertEqual(
+            reports[1].status,
+            otio::MediaVerificationReport::not_checked);
+
+        fs::remove_all(root);
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -3,7 +3,15 @@
 
 #include "utils.h"
 
+#include <opentime/exactTime.h>
 #include <opentime/rationalTime.h>
+#include <opentime/rationalTimeArray.h>
+#include <opentime/timeRangeArray.h>
+
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace otime = opentime::OPENTIME_VERSION;
 
@@ -129,6 +137,307 @@ main(int argc, char** argv)
         assertTrue(t.almost_equal(time_obj, 0.001));
     });
 
+    tests.add_test("test_parse_string_view", [] {
+        // fields parsed out of a larger buffer are not null terminated, and
+        // the characters after them must not be read
+        std::string_view line = "01:00:00;0200:01:005";
+
+        otime::ErrorStatus err;
+        auto t = otime::RationalTime::from_timecode(
+            line.substr(0, 11),
+            30000.0 / 1001.0,
+            &err);
+        assertFalse(otime::is_error(err));
+        assertEqual(t.value(), 107894.0);
+
+        t = otime::RationalTime::from_time_string(line.substr(11, 8), 24, &err);
+        assertFalse(otime::is_error(err));
+        assertEqual(t.value(), 1440.0);
+
+        otime::RationalTime::from_timecode(line.substr(0, 7), 24, &err);
+        assertEqual(err.outcome, otime::ErrorStatus::INVALID_TIMECODE_STRING);
+
+        otime::RationalTime::from_time_string(line.substr(8), 24, &err);
+        assertEqual(err.outcome, otime::ErrorStatus::INVALID_TIME_STRING);
+        assertEqual(
+            err.details,
+            std::string("Error: ';0200:01:005' - invalid time string"));
+    });
+
+    tests.add_test("test_exact_time", [] {
+        double const ntsc = 30000.0 / 1001.0;
+
+        auto t = otime::ExactTime::from_rational_time(otime::RationalTime(7, ntsc));
+        assertTrue(bool(t));
+        assertEqual(t->value(), int64_t(7));
+        assertEqual(t->rate_numerator(), int64_t(30000));
+        assertEqual(t->rate_denominator(), int64_t(1001));
+        assertTrue(t->to_rational_time().strictly_equal(otime::RationalTime(7, ntsc)));
+
+        // decimal rates are kept as written, and reduced
+        auto d = otime::ExactTime::from_rational_time(otime::RationalTime(3, 29.97));
+        assertTrue(bool(d));
+        assertEqual(d->rate_numerator(), int64_t(2997));
+        assertEqual(d->rate_denominator(), int64_t(100));
+
+        // no lossless form for fractional frames or irrational looking rates
+        assertFalse(bool(otime::ExactTime::from_rational_time(otime::RationalTime(1.5, 24))));
+        assertFalse(bool(otime::ExactTime::from_rational_time(otime::RationalTime(1, 1.0 / 3.0))));
+        assertFalse(bool(otime::ExactTime::from_rational_time(otime::RationalTime(1, -24))));
+
+        // sums across rates land on their common rate
+        otime::ExactTime a(1, 24);
+        otime::ExactTime b(1, 30);
+        otime::ExactTime sum = a + b;
+        assertEqual(sum.value(), int64_t(9));
+        assertEqual(sum.rate_numerator(), int64_t(120));
+        assertEqual(sum - b, a);
+        assertEqual(otime::ExactTime(2, 48), otime::ExactTime(1, 24));
+        assertTrue(a > b);
+        assertTrue(otime::ExactTime(1, 24000, 1001) == otime::ExactTime(1001, 24000));
+
+        // summing many NTSC frames is exact
+        otime::ExactTime total(0, 24);
+        otime::ExactTime frame(1, 24000, 1001);
+        for (int i = 0; i < 240000; ++i)
+        {
+            total += frame;
+        }
+        assertEqual(total, otime::ExactTime(240240, 24));
+        assertEqual(total.to_rational_time(24).value(), 240240.0);
+
+        // overflow gives an invalid time rather than wrapping
+        int64_t const max = std::numeric_limits<int64_t>::max();
+        assertTrue((otime::ExactTime(max, 24) + otime::ExactTime(1, 24)).is_invalid_time());
+        assertTrue((-otime::ExactTime(std::numeric_limits<int64_t>::min(), 24)).is_invalid_time());
+        assertTrue(otime::ExactTime(max / 2, 24).rescaled_to_common_rate(otime::ExactTime(0, 25)).is_invalid_time());
+        assertTrue((otime::ExactTime(1, max, 1) + otime::ExactTime(1, max - 1, 1)).is_invalid_time());
+        assertTrue(otime::ExactTime(1, 0).is_invalid_time());
+        assertFalse(otime::ExactTime(1, 0) == otime::ExactTime(1, 0));
+
+        // times whose common rate overflows still compare
+        assertTrue(otime::ExactTime(max / 2, 24) > otime::ExactTime(1, 25));
+        assertTrue(otime::ExactTime(1, max, 1) < otime::ExactTime(1, max - 1, 1));
+    });
+
+    tests.add_test("test_time_arrays", [] {
+        double const rates[] = { 24, 24000.0 / 1001.0, 25, 30000.0 / 1001.0, 48 };
+
+        std::vector<otime::RationalTime> times;
+        std::vector<otime::TimeRange>    ranges;
+        otime::RationalTimeArray         time_array;
+        otime::TimeRangeArray            range_array;
+        for (int i = 0; i < 1000; ++i)
+        {
+            double const rate = rates[i % 5];
+            otime::RationalTime const time(i * 7.5 - 100, rate);
+            otime::TimeRange const    range(
+                time,
+                otime::RationalTime(i % 13 + 1, rates[(i / 5) % 5]));
+            times.push_back(time);
+            ranges.push_back(range);
+            time_array.push_back(time);
+            range_array.push_back(range);
+        }
+
+        // every kernel matches the scalar operation exactly
+        otime::RationalTime const other(31, 30000.0 / 1001.0);
+        otime::RationalTimeArray  sums = time_array;
+        sums.add(other);
+        otime::RationalTimeArray pairwise = time_array;
+        pairwise.add(range_array.durations());
+        otime::RationalTimeArray rescaled = time_array;
+        rescaled.rescale_to(25);
+        otime::RationalTimeArray ends = range_array.end_times_exclusive();
+        for (size_t i = 0; i < times.size(); ++i)
+        {
+            assertTrue(sums[i].strictly_equal(times[i] + other));
+            assertTrue(pairwise[i].strictly_equal(
+                times[i] + ranges[i].duration()));
+            assertTrue(rescaled[i].strictly_equal(times[i].rescaled_to(25)));
+            assertTrue(ends[i].strictly_equal(ranges[i].end_time_exclusive()));
+        }
+
+        std::vector<uint8_t> result(times.size());
+        size_t count = time_array.less_than(other, result.data());
+        size_t expected = 0;
+        for (size_t i = 0; i < times.size(); ++i)
+        {
+            assertEqual(bool(result[i]), times[i] < other);
+            expected += times[i] < other;
+        }
+        assertEqual(count, expected);
+
+        count = time_array.greater_than(other, result.data());
+        for (size_t i = 0; i < times.size(); ++i)
+        {
+            assertEqual(bool(result[i]), times[i] > other);
+        }
+
+        for (int frame = -200; frame < 8000; frame += 97)
+        {
+            otime::RationalTime const playhead(frame, 24);
+            count    = range_array.contains(playhead, result.data());
+            expected = 0;
+            for (size_t i = 0; i < ranges.size(); ++i)
+            {
+                assertEqual(bool(result[i]), ranges[i].contains(playhead));
+                expected += ranges[i].contains(playhead);
+            }
+            assertEqual(count, expected);
+        }
+
+        otime::TimeRange const window(
+            otime::RationalTime(100, 24),
+            otime::RationalTime(48, 24));
+        range_array.contains(window, result.data());
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            assertEqual(bool(result[i]), ranges[i].contains(window));
+        }
+        range_array.overlaps(window, result.data());
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            assertEqual(bool(result[i]), ranges[i].overlaps(window));
+        }
+        count = range_array.intersects(window, result.data());
+        assertTrue(count > 0);
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            assertEqual(bool(result[i]), ranges[i].intersects(window));
+        }
+
+        // the seconds kept for the predicates follow changes to the ranges
+        otime::TimeRangeArray rescaled_ranges = range_array;
+        rescaled_ranges.rescale_to(30000.0 / 1001.0);
+        rescaled_ranges.set(0, window);
+        otime::RationalTime const playhead(101, 24);
+        rescaled_ranges.contains(playhead, result.data());
+        assertTrue(result[0]);
+        for (size_t i = 1; i < ranges.size(); ++i)
+        {
+            otime::TimeRange const range(
+                ranges[i].start_time().rescaled_to(30000.0 / 1001.0),
+                ranges[i].duration().rescaled_to(30000.0 / 1001.0));
+            assertEqual(bool(result[i]), range.contains(playhead));
+        }
+
+        // durations laid end to end, as in a track
+        otime::RationalTimeArray const& durations = range_array.durations();
+        otime::RationalTimeArray const  running =
+            durations.cumulative_sum(otime::RationalTime(0, 24));
+        otime::TimeRangeArray const laid_out = otime::TimeRangeArray::from_durations(
+            otime::RationalTime(0, 24),
+            durations);
+        assertEqual(running.size(), durations.size() + 1);
+        otime::RationalTime sum(0, 24);
+        otime::RationalTime last_end(0, 24);
+        for (size_t i = 0; i < durations.size(); ++i)
+        {
+            assertTrue(running[i].strictly_equal(sum));
+            sum = sum + durations[i];
+
+            otime::TimeRange const range(last_end, durations[i]);
+            assertTrue(laid_out[i].start_time().strictly_equal(
+                range.start_time()));
+            assertTrue(laid_out[i].duration().strictly_equal(range.duration()));
+            last_end = range.end_time_exclusive();
+        }
+        assertTrue(running[durations.size()].strictly_equal(sum));
+    });
+
+    tests.add_test("test_batch_timecode", [] {
+        std::vector<int64_t> frames;
+        for (int64_t f = 0; f < 200000; f += 7)
+        {
+            frames.push_back(f);
+        }
+        // around the ten minute and 24 hour boundaries
+        for (int64_t f: { 17981, 17982, 17983, 35964, 2589407, 2589408 })
+        {
+            frames.push_back(f);
+        }
+
+        size_t const len = otime::RationalTime::timecode_length;
+        std::string  buffer(frames.size() * len, ' ');
+        std::vector<int64_t> parsed(frames.size());
+
+        for (double rate: { 24000.0 / 1001.0, 24.0, 25.0, 30000.0 / 1001.0,
+                            30.0, 48000.0 / 1001.0, 48.0, 50.0,
+                            60000.0 / 1001.0, 60.0 })
+        {
+            for (auto drop: { otime::InferFromRate, otime::ForceNo })
+            {
+                otime::ErrorStatus err;
+                assertTrue(otime::RationalTime::to_timecodes(
+                    frames.data(),
+                    frames.size(),
+                    rate,
+                    drop,
+                    &buffer[0],
+                    &err));
+                assertFalse(otime::is_error(err));
+                assertTrue(otime::RationalTime::from_timecodes(
+                    buffer.data(),
+                    frames.size(),
+                    rate,
+                    parsed.data(),
+                    &err));
+                assertFalse(otime::is_error(err));
+
+                for (size_t i = 0; i < frames.size(); ++i)
+                {
+                    std::string timecode = buffer.substr(i * len, len);
+                    assertEqual(
+                        otime::RationalTime(double(frames[i]), rate)
+                            .to_timecode(rate, drop),
+                        timecode);
+                    assertEqual(
+                        otime::RationalTime::from_timecode(timecode, rate)
+                            .value(),
+                        double(parsed[i]));
+                }
+            }
+        }
+    });
+
+    tests.add_test("test_batch_timecode_errors", [] {
+        int64_t            frames[] = { 0, 24, -1 };
+        char               buffer[3 * otime::RationalTime::timecode_length];
+        otime::ErrorStatus err;
+
+        assertFalse(otime::RationalTime::to_timecodes(
+            frames, 3, 24, otime::InferFromRate, buffer, &err));
+        assertEqual(err.outcome, otime::ErrorStatus::NEGATIVE_VALUE);
+        assertEqual(std::string(buffer, 22), std::string("00:00:00:0000:00:01:00"));
+
+        assertFalse(otime::RationalTime::to_timecodes(
+            frames, 2, 24, otime::ForceYes, buffer, &err));
+        assertEqual(
+            err.outcome,
+            otime::ErrorStatus::INVALID_RATE_FOR_DROP_FRAME_TIMECODE);
+
+        assertFalse(otime::RationalTime::to_timecodes(
+            frames, 2, 13, otime::InferFromRate, buffer, &err));
+        assertEqual(err.outcome, otime::ErrorStatus::INVALID_TIMECODE_RATE);
+
+        int64_t parsed[2];
+        assertFalse(otime::RationalTime::from_timecodes(
+            "00:00:01:0000:00:01;00", 2, 24, parsed, &err));
+        assertEqual(
+            err.outcome,
+            otime::ErrorStatus::INVALID_RATE_FOR_DROP_FRAME_TIMECODE);
+        assertEqual(parsed[0], int64_t(24));
+
+        assertFalse(otime::RationalTime::from_timecodes(
+            "00:00:01:24", 1, 24, parsed, &err));
+        assertEqual(err.outcome, otime::ErrorStatus::TIMECODE_RATE_MISMATCH);
+
+        assertFalse(otime::RationalTime::from_timecodes(
+            "00:0x:01:00", 1, 24, parsed, &err));
+        assertEqual(err.outcome, otime::ErrorStatus::INVALID_TIMECODE_STRING);
+    });
+
     tests.run(argc, argv);
     return 0;
 }
@@ -7,6 +7,7 @@
 
 import unittest
 import os
+import shutil
 import tempfile
 
 import opentimelineio as otio
@@ -187,6 +188,72 @@ class OTIODTester(unittest.TestCase, otio_test_utils.OTIOAssertions):
 
         self.assertJsonEqual(result, self.tl)
 
+    def test_file_bundle_manifest_deduplicated(self):
+        # a byte-identical copy of one of the media files under another name
+        tmp_dir = tempfile.mkdtemp()
+        self.addCleanup(shutil.rmtree, tmp_dir)
+        copy_path = os.path.join(tmp_dir, "copy_of_dark.png")
+        shutil.copyfile(MEDIA_EXAMPLE_PATH_REL, copy_path)
+
+        clips = list(self.tl.find_clips())
+        clips[0].media_reference.target_url = (
+            otio.url_utils.url_from_filepath(copy_path)
+        )
+
+        _, manifest = file_bundle_utils._prepped_otio_for_bundle_and_manifest(
+            input_otio=self.tl,
+            media_policy=file_bundle_utils.MediaReferencePolicy.ErrorIfNotFile,
+            adapter_name="TEST_NAME",
+        )
+        self.assertEqual(len(manifest.keys()), 3)
+
+        _, manifest = file_bundle_utils._prepped_otio_for_bundle_and_manifest(
+            input_otio=self.tl,
+            media_policy=file_bundle_utils.MediaReferencePolicy.ErrorIfNotFile,
+            adapter_name="TEST_NAME",
+            deduplicate_media=True,
+            max_workers=4,
+        )
+        self.assertEqual(len(manifest.keys()), 2)
+        self.assertEqual(
+            sum(len(references) for references in manifest.values()),
+            len(clips)
+        )
+
+    def test_round_trip_with_progress(self):
+        with tempfile.NamedTemporaryFile(suffix=".otiod") as bogusfile:
+            tmp_path = bogusfile.name
+        self.addCleanup(shutil.rmtree, tmp_path, ignore_errors=True)
+
+        progress = []
+        otio.adapters.write_to_file(
+            self.tl,
+            tmp_path,
+            max_workers=2,
+            progress_callback=lambda done, total: progress.append((done, total))
+        )
+
+        expected_size = (
+            os.path.getsize(MEDIA_EXAMPLE_PATH_REL) +
+            os.path.getsize(MEDIA_EXAMPLE_PATH_ABS)
+        )
+        self.assertEqual(len(progress), 2)
+        self.assertEqual(progress[-1], (expected_size, expected_size))
+
+        media_dir = os.path.join(
+            tmp_path,
+            otio.adapters.file_bundle_utils.BUNDLE_DIR_NAME
+        )
+        self.assertEqual(
+            sorted(os.listdir(media_dir)),
+            sorted(
+                [
+                    os.path.basename(MEDIA_EXAMPLE_PATH_REL),
+                    os.path.basename(MEDIA_EXAMPLE_PATH_ABS),
+                ]
+            )
+        )
+
 
 if __name__ == "__main__":
     unittest.main()
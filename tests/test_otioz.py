@@ -118,6 +118,53 @@ class OTIOZTester(unittest.TestCase, otio_test_utils.OTIOAssertions):
 
         shutil.rmtree(tempdir)
 
+    def test_colliding_basename_deduplicated(self):
+        # an identical copy is bundled once, so its basename cannot collide
+        tempdir = tempfile.mkdtemp()
+        self.addCleanup(shutil.rmtree, tempdir)
+        new_path = os.path.join(
+            tempdir,
+            os.path.basename(MEDIA_EXAMPLE_PATH_ABS)
+        )
+        shutil.copyfile(
+            MEDIA_EXAMPLE_PATH_ABS,
+            new_path
+        )
+        list(self.tl.find_clips())[0].media_reference.target_url = (
+            otio.url_utils.url_from_filepath(new_path)
+        )
+
+        with tempfile.NamedTemporaryFile(suffix=".otioz") as bogusfile:
+            fname = bogusfile.name
+
+        size = otio.adapters.write_to_file(
+            self.tl,
+            fname,
+            dryrun=True,
+            deduplicate_media=True
+        )
+        self.assertEqual(
+            size,
+            os.path.getsize(MEDIA_EXAMPLE_PATH_ABS) +
+            os.path.getsize(MEDIA_EXAMPLE_PATH_REL)
+        )
+
+        progress = []
+        otio.adapters.write_to_file(
+            self.tl,
+            fname,
+            deduplicate_media=True,
+            progress_callback=lambda done, total: progress.append((done, total))
+        )
+        self.addCleanup(os.remove, fname)
+        self.assertEqual(progress[-1], (size, size))
+
+        result = otio.adapters.read_from_file(fname)
+        self.assertEqual(
+            len({cl.media_reference.target_url for cl in result.find_clips()}),
+            2
+        )
+
     def test_round_trip(self):
         with tempfile.NamedTemporaryFile(suffix=".otioz") as bogusfile:
             tmp_path = bogusfile.name
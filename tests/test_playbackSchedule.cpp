@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/gap.h>
+#include <opentimelineio/mediaTimeEvaluator.h>
+#include <opentimelineio/playbackSchedule.h>
+#include <opentimelineio/timeline.h>
+#include <opentimelineio/track.h>
+#include <opentimelineio/transition.h>
+
+#include <iostream>
+
+namespace otime = opentime::OPENTIME_VERSION;
+namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
+
+namespace {
+
+otio::TimeRange
+frames(double start, double duration, double rate = 24)
+{
+    return otio::TimeRange(
+        otio::RationalTime(start, rate),
+        otio::RationalTime(duration, rate));
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    // global start 86400 at 24
+    // video
+    //   clip_a [0, 20)   source 100-120
+    //   dissolve         2 frames either side of the cut
+    //   clip_b [20, 30)  source 0-10
+    // overlay, at 48
+    //   gap    [0, 10)
+    //   clip_c [10, 30)  source 10-50 at 48
+    using otio::SerializableObject;
+    SerializableObject::Retainer<otio::Timeline> timeline = new otio::Timeline(
+        "timeline",
+        otio::RationalTime(86400, 24));
+    SerializableObject::Retainer<otio::Track> video   = new otio::Track();
+    SerializableObject::Retainer<otio::Track> overlay = new otio::Track();
+    SerializableObject::Retainer<otio::Clip>  clip_a =
+        new otio::Clip("a", nullptr, frames(100, 20));
+    SerializableObject::Retainer<otio::Clip> clip_b =
+        new otio::Clip("b", nullptr, frames(0, 10));
+    SerializableObject::Retainer<otio::Clip> clip_c =
+        new otio::Clip("c", nullptr, frames(10, 40, 48));
+    SerializableObject::Retainer<otio::Transition> dissolve =
+        new otio::Transition(
+            "dissolve",
+            otio::Transition::Type::SMPTE_Dissolve,
+            otio::RationalTime(2, 24),
+            otio::RationalTime(2, 24));
+
+    timeline->tracks()->append_child(video);
+    timeline->tracks()->append_child(overlay);
+    video->append_child(clip_a);
+    video->append_child(dissolve);
+    video->append_child(clip_b);
+    overlay->append_child(new otio::Gap(frames(0, 20, 48)));
+    overlay->append_child(clip_c);
+
+    tests.add_test("test_schedule", [&] {
+        otio::PlaybackScheduleCompiler compiler(timeline);
+        otio::ErrorStatus              err;
+        auto const                     schedule = compiler.schedule(&err);
+        assertFalse(otio::is_error(err));
+        assertTrue(schedule != nullptr);
+        assertEqual(schedule->rate(), 24.0);
+        assertEqual(schedule->range(), frames(86400, 30));
+        assertEqual(schedule->track_count(), size_t(2));
+
+        auto const& entries = schedule->entries();
+        assertEqual(entries.size(), size_t(3));
+        assertEqual(entries[0].clip, clip_a.value);
+        assertEqual(entries[0].start, 86400.0);
+        assertEqual(entries[0].end, 86420.0);
+        assertEqual(entries[0].track_index, size_t(0));
+        assertEqual(entries[1].clip, clip_c.value);
+        assertEqual(entries[1].start, 86410.0);
+        assertEqual(entries[1].end, 86430.0);
+        assertEqual(entries[1].track_index, size_t(1));
+        assertEqual(entries[2].clip, clip_b.value);
+        assertEqual(entries[2].start, 86420.0);
+        assertEqual(entries[2].end, 86430.0);
+
+        otio::RationalTime const a_time(105, 24);
+        otio::RationalTime const c_time(20, 48);
+        otio::RationalTime const b_time(9, 24);
+        assertEqual(entries[0].media_time(86405), a_time);
+        assertEqual(entries[1].media_time(86415), c_time);
+        assertEqual(entries[2].media_time(86429), b_time);
+
+        auto const& transitions = schedule->transitions();
+        assertEqual(transitions.size(), size_t(1));
+        assertEqual(transitions[0].transition, dissolve.value);
+        assertEqual(transitions[0].start, 86418.0);
+        assertEqual(transitions[0].end, 86422.0);
+        assertEqual(transitions[0].track_index, size_t(0));
+        assertEqual(
+            transitions[0].outgoing,
+            static_cast<otio::Item const*>(clip_a.value));
+        assertEqual(
+            transitions[0].incoming,
+            static_cast<otio::Item const*>(clip_b.value));
+    });
+
+    tests.add_test("test_lookup", [&] {
+        otio::PlaybackScheduleCompiler compiler(timeline);
+        auto const                     schedule = compiler.schedule();
+
+        std::vector<otio::PlaybackSchedule::Entry const*> found;
+        schedule->entries_at(otio::RationalTime(86405, 24), found);
+        assertEqual(found.size(), size_t(1));
+        assertEqual(found[0]->clip, clip_a.value);
+
+        schedule->entries_at(otio::RationalTime(172850, 48), found);
+        assertEqual(found.size(), size_t(2));
+        assertEqual(found[0]->clip, clip_b.value);
+        assertEqual(found[1]->clip, clip_c.value);
+
+        schedule->entries_at(otio::RationalTime(86430, 24), found);
+        assertTrue(found.empty());
+        otio::RationalTime const before_c(86409, 24);
+        assertTrue(schedule->entry_at(1, before_c) == nullptr);
+        assertTrue(schedule->entry_at(2, before_c) == nullptr);
+
+        assertEqual(
+            schedule->first_entry_after(otio::RationalTime(86300, 24)),
+            size_t(0));
+        assertEqual(
+            schedule->first_entry_after(otio::RationalTime(86419, 24)),
+            size_t(0));
+        assertEqual(
+            schedule->first_entry_after(otio::RationalTime(86420, 24)),
+            size_t(1));
+        assertEqual(
+            schedule->first_entry_after(otio::RationalTime(86430, 24)),
+            schedule->entries().size());
+    });
+
+    tests.add_test("test_recompiles_after_edits", [&] {
+        otio::PlaybackScheduleCompiler compiler(timeline);
+        auto const                     first = compiler.schedule();
+        assertTrue(compiler.is_current());
+        assertEqual(compiler.schedule(), first);
+
+        // An earlier schedule is left as it was.
+        clip_c->set_source_range(frames(10, 20, 48));
+        assertFalse(compiler.is_current());
+        auto const second = compiler.schedule();
+        assertTrue(second != first);
+        assertEqual(first->entries()[1].end, 86430.0);
+        assertEqual(second->entries()[1].end, 86420.0);
+
+        timeline->set_global_start_time(otio::RationalTime(0, 24));
+        assertFalse(compiler.is_current());
+        auto const third = compiler.schedule();
+        assertEqual(third->entries()[0].start, 0.0);
+        assertEqual(
+            third->entries()[0].media_time(5),
+            otio::RationalTime(105, 24));
+
+        clip_c->set_source_range(frames(10, 40, 48));
+        timeline->set_global_start_time(otio::RationalTime(86400, 24));
+    });
+
+    tests.add_test("test_only_edited_tracks_recompile", [&] {
+        otio::MediaTimeEvaluator evaluator(timeline);
+        auto const* video_table   = evaluator.segments(0).data();
+        auto const* overlay_table = evaluator.segments(1).data();
+
+        clip_c->set_source_range(frames(10, 20, 48));
+        assertFalse(evaluator.is_current());
+        assertEqual(evaluator.segments(0).data(), video_table);
+        assertTrue(evaluator.segments(1).data() != overlay_table);
+        assertEqual(evaluator.segments(1)[0].end, 40.0);
+
+        evaluator.invalidate();
+        assertFalse(evaluator.is_current());
+        assertEqual(evaluator.segments(0).size(), size_t(2));
+        assertTrue(evaluator.is_current());
+
+        clip_c->set_source_range(frames(10, 40, 48));
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -4,15 +4,25 @@
 #include "utils.h"
 
 #include <opentimelineio/clip.h>
+#include <opentimelineio/deserialization.h>
+#include <opentimelineio/externalReference.h>
+#include <opentimelineio/marker.h>
+#include <opentimelineio/serializableCollection.h>
 #include <opentimelineio/timeline.h>
 #include <opentimelineio/track.h>
 #include <opentimelineio/serialization.h>
 #include <opentimelineio/serializableObject.h>
 #include <opentimelineio/serializableObjectWithMetadata.h>
 #include <opentimelineio/safely_typed_any.h>
+#include <opentimelineio/anyKind.h>
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
 
 namespace otime = opentime::OPENTIME_VERSION;
 namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
@@ -112,6 +122,338 @@ main(int argc, char** argv)
 })CONTENT");
     });
 
+    tests.add_test(
+        "any_kind classifies metadata values", [] {
+        assertEqual(otio::any_kind(std::any()), otio::AnyKind::null);
+        assertEqual(otio::any_kind(std::any(true)), otio::AnyKind::boolean);
+        assertEqual(
+            otio::any_kind(otio::create_safely_typed_any(int64_t(3))),
+            otio::AnyKind::int64);
+        assertEqual(
+            otio::any_kind(otio::create_safely_typed_any(std::string("s"))),
+            otio::AnyKind::string);
+        assertEqual(
+            otio::any_kind(std::any(otio::TimeRange())),
+            otio::AnyKind::time_range);
+        assertEqual(
+            otio::any_kind(std::any(otio::AnyVector())),
+            otio::AnyKind::vector);
+        assertEqual(
+            otio::any_kind(std::any(otio::SerializableObject::Retainer<>())),
+            otio::AnyKind::retainer);
+        assertEqual(otio::any_kind(std::any(1.5f)), otio::AnyKind::unknown);
+
+        // values of an unknown kind are reported and written as null
+        otio::SerializableObject::Retainer<otio::SerializableObjectWithMetadata> so =
+            new otio::SerializableObjectWithMetadata();
+        so.value->metadata()["ok"]  = otio::RationalTime(1, 24);
+        so.value->metadata()["bad"] = 1.5f;
+
+        otio::ErrorStatus err;
+        auto output = so.value->to_json_string(&err, {}, 0);
+        assertEqual(err.outcome, otio::ErrorStatus::TYPE_MISMATCH);
+        assertFalse(so.value->is_equivalent_to(*so.value));
+
+        so.value->metadata().erase("bad");
+        err    = otio::ErrorStatus();
+        output = so.value->to_json_string(&err, {}, 0);
+        assertFalse(otio::is_error(err));
+        assertTrue(so.value->is_equivalent_to(*so.value));
+    });
+
+    tests.add_test(
+        "parallel output matches serial output", [] {
+        using otio::SerializableObject;
+        auto make_timeline = [](std::string const& name) {
+            SerializableObject::Retainer<otio::Timeline> timeline =
+                new otio::Timeline(name);
+            for (int t = 0; t < 6; ++t)
+            {
+                auto track = new otio::Track("track " + std::to_string(t));
+                for (int c = 0; c < 20; ++c)
+                {
+                    auto clip = new otio::Clip(
+                        "clip \"" + std::to_string(c) + "\"\n",
+                        nullptr,
+                        otio::TimeRange(
+                            otio::RationalTime(c, 24),
+                            otio::RationalTime(10, 24)));
+                    clip->metadata()["index"] = int64_t(c);
+                    track->append_child(clip);
+                }
+                timeline->tracks()->append_child(track);
+            }
+            // an empty track and a nested stack
+            timeline->tracks()->append_child(new otio::Track());
+            auto stack = new otio::Stack("nested");
+            stack->append_child(new otio::Track("inner"));
+            timeline->tracks()->append_child(stack);
+            return timeline;
+        };
+
+        SerializableObject::Retainer<otio::SerializableCollection> collection =
+            new otio::SerializableCollection("collection");
+        collection->insert_child(0, make_timeline("a"));
+        collection->insert_child(1, new otio::Clip("loose"));
+        collection->insert_child(2, make_timeline("b"));
+
+        for (std::any const& value:
+             { std::any(SerializableObject::Retainer<>(make_timeline("t"))),
+               std::any(SerializableObject::Retainer<>(collection)) })
+        {
+            for (int indent: { 4, 2, 0, -1 })
+            {
+                otio::ErrorStatus err;
+                auto const serial =
+                    otio::serialize_json_to_string(value, {}, &err, indent, 1);
+                assertFalse(otio::is_error(err));
+                for (int thread_count: { 0, 2, 5 })
+                {
+                    auto const parallel = otio::serialize_json_to_string(
+                        value,
+                        {},
+                        &err,
+                        indent,
+                        thread_count);
+                    assertFalse(otio::is_error(err));
+                    assertEqual(parallel, serial);
+                }
+            }
+
+            std::string const path = "parallel_serialization_test.otio";
+            std::string       files[2];
+            for (int i = 0; i < 2; ++i)
+            {
+                otio::ErrorStatus err;
+                assertTrue(otio::serialize_json_to_file(
+                    value,
+                    path,
+                    {},
+                    &err,
+                    -1,
+                    i == 0 ? 1 : 4));
+                std::ifstream     in(path);
+                std::stringstream contents;
+                contents << in.rdbuf();
+                files[i] = contents.str();
+            }
+            std::remove(path.c_str());
+            assertEqual(files[1], files[0]);
+        }
+
+        // an error in one of the tracks is reported as it is without threads
+        auto timeline = make_timeline("bad");
+        auto track    = dynamic_cast<otio::Track*>(
+            timeline->tracks()->children()[3].value);
+        track->children()[0]->metadata()["bad"] = 1.5f;
+        otio::ErrorStatus err;
+        auto const output = otio::serialize_json_to_string(
+            std::any(SerializableObject::Retainer<>(timeline)),
+            {},
+            &err,
+            4,
+            4);
+        assertEqual(err.outcome, otio::ErrorStatus::TYPE_MISMATCH);
+        assertEqual(output, std::string());
+    });
+
+    tests.add_test(
+        "convert_json_string matches reading and serializing", [] {
+        using otio::SerializableObject;
+        SerializableObject::Retainer<otio::Timeline> timeline =
+            new otio::Timeline("converted");
+        for (int t = 0; t < 3; ++t)
+        {
+            auto track = new otio::Track("track " + std::to_string(t));
+            for (int c = 0; c < 4; ++c)
+            {
+                auto clip = new otio::Clip(
+                    "clip " + std::to_string(c),
+                    new otio::ExternalReference("file.mov"),
+                    otio::TimeRange(
+                        otio::RationalTime(c, 24),
+                        otio::RationalTime(10, 24)));
+                clip->metadata()["nested"] = otio::AnyDictionary{
+                    { "b", 1.5 },
+                    { "a", otio::AnyVector{ int64_t(1), std::string("s") } }
+                };
+                track->append_child(clip);
+            }
+            track->markers().push_back(new otio::Marker("marker"));
+            timeline->tracks()->append_child(track);
+        }
+        std::any const value{ SerializableObject::Retainer<>(timeline) };
+
+        auto const& targets = otio::CORE_VERSION_MAP.at("0.14.0");
+        otio::ErrorStatus err;
+        auto const current = otio::serialize_json_to_string(value, {}, &err);
+        auto const older =
+            otio::serialize_json_to_string(value, &targets, &err);
+        assertFalse(otio::is_error(err));
+        assertTrue(older.find("\"Clip.1\"") != std::string::npos);
+
+        // downgrading, and upgrading back
+        assertEqual(otio::convert_json_string(current, &targets, &err), older);
+        assertFalse(otio::is_error(err));
+        assertEqual(otio::convert_json_string(older, {}, &err), current);
+        assertFalse(otio::is_error(err));
+        assertEqual(otio::convert_json_string(current, {}, &err), current);
+        assertEqual(
+            otio::convert_json_string(current, &targets, &err, 0),
+            otio::serialize_json_to_string(value, &targets, &err, 0));
+
+        // as a file
+        std::string const input  = "convert_test_input.otio";
+        std::string const output = "convert_test_output.otio";
+        assertTrue(otio::serialize_json_to_file(value, input, {}, &err));
+        assertTrue(otio::convert_json_file(input, output, &targets, &err));
+        std::ifstream     in(output);
+        std::stringstream contents;
+        contents << in.rdbuf();
+        std::remove(input.c_str());
+        std::remove(output.c_str());
+        assertEqual(contents.str(), older);
+
+        // schemas that are not registered, and JSON that OTIO did not write
+        for (std::string const json: {
+                 R"({"OTIO_SCHEMA": "NotRegistered.3", "value": 1})",
+                 R"({"name": "late", "metadata": {},
+                     "OTIO_SCHEMA": "SerializableObjectWithMetadata.1"})",
+                 R"({"OTIO_SCHEMA": "Sequence.1", "kind": "Video",
+                     "children": [{"OTIO_SCHEMA": "Filler.1",
+                                   "source_range": null}]})" })
+        {
+            std::any read;
+            assertTrue(otio::deserialize_json_from_string(json, &read, &err));
+            auto const expected =
+                otio::serialize_json_to_string(read, &targets, &err);
+            assertFalse(otio::is_error(err));
+            assertEqual(otio::convert_json_string(json, &targets, &err), expected);
+            assertFalse(otio::is_error(err));
+        }
+
+        // errors in converted objects are reported
+        auto const converted = otio::convert_json_string(
+            R"({"OTIO_SCHEMA": "Clip.1", "name": 3})",
+            {},
+            &err);
+        assertTrue(otio::is_error(err));
+        assertEqual(converted, std::string());
+    });
+
+    tests.add_test(
+        "lazy metadata is read and written as it would be eagerly", [] {
+        using otio::SerializableObject;
+        SerializableObject::Retainer<otio::Timeline> timeline =
+            new otio::Timeline("lazy");
+        timeline->metadata()["studio"] = otio::AnyDictionary{
+            { "z", int64_t(3) },
+            { "a", otio::AnyVector{ 0.25, std::string("s"), std::any() } }
+        };
+        auto track = new otio::Track("track");
+        for (int c = 0; c < 3; ++c)
+        {
+            auto clip = new otio::Clip("clip " + std::to_string(c));
+            clip->metadata()["index"] = int64_t(c);
+            clip->metadata()["frames"] = otio::AnyVector{ true, 1.5 };
+            track->append_child(clip);
+        }
+        track->metadata()["marker"] =
+            SerializableObject::Retainer<>(new otio::Marker("held"));
+        timeline->tracks()->append_child(track);
+        std::any const value{ SerializableObject::Retainer<>(timeline) };
+
+        otio::ErrorStatus err;
+        auto const json = otio::serialize_json_to_string(value, {}, &err);
+
+        auto read = [&](bool lazy_metadata) {
+            std::any result;
+            assertTrue(otio::deserialize_json_from_string(
+                json,
+                &result,
+                &err,
+                lazy_metadata));
+            return std::any_cast<SerializableObject::Retainer<>>(result);
+        };
+        auto lazy = read(true);
+
+        // untouched metadata is written back from the JSON
+        for (int indent: { 4, 0 })
+        {
+            assertEqual(
+                otio::serialize_json_to_string(
+                    std::any{ lazy }, {}, &err, indent),
+                otio::serialize_json_to_string(
+                    std::any{ read(false) }, {}, &err, indent));
+            assertFalse(otio::is_error(err));
+        }
+        assertTrue(lazy->is_equivalent_to(*read(false)));
+        SerializableObject::Retainer<> const lazy_clone(lazy->clone(&err));
+        assertTrue(lazy_clone->is_equivalent_to(*timeline));
+
+        auto const lazy_timeline = dynamic_cast<otio::Timeline*>(lazy.value);
+        auto const lazy_track    = dynamic_cast<otio::Track*>(
+            lazy_timeline->tracks()->children()[0].value);
+        auto const lazy_clip = dynamic_cast<otio::Clip const*>(
+            lazy_track->children()[2].value);
+
+        // metadata holding objects is read as it is eagerly
+        auto const marker = lazy_track->metadata()["marker"];
+        assertEqual(
+            std::any_cast<SerializableObject::Retainer<>>(marker)
+                ->schema_name(),
+            std::string("Marker"));
+
+        // const objects parse metadata but keep the JSON, which other
+        // threads can do at once
+        std::vector<std::thread> threads;
+        std::atomic<int>         matched(0);
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&] {
+                auto const metadata = lazy_clip->metadata();
+                matched += std::any_cast<int64_t>(metadata.at("index")) == 2;
+            });
+        }
+        for (auto& thread: threads)
+        {
+            thread.join();
+        }
+        assertEqual(matched.load(), 4);
+
+        // changes made through non-const objects are written
+        lazy_timeline->metadata()["studio"] = std::string("changed");
+        timeline->metadata()["studio"]      = std::string("changed");
+        assertEqual(
+            otio::serialize_json_to_string(std::any{ lazy }, {}, &err),
+            otio::serialize_json_to_string(value, {}, &err));
+
+        // unknown schemas keep their metadata as values
+        std::any unknown;
+        assertTrue(otio::deserialize_json_from_string(
+            R"({"OTIO_SCHEMA": "NotRegistered.1", "metadata": {"a": 1}})",
+            &unknown,
+            &err,
+            true));
+        assertEqual(
+            otio::serialize_json_to_string(unknown, {}, &err, 0),
+            std::string(
+                R"({"OTIO_SCHEMA":"NotRegistered.1","metadata":{"a":1}})"));
+
+        // as do schemas without SerializableObjectWithMetadata's metadata
+        std::any plain;
+        assertTrue(otio::deserialize_json_from_string(
+            R"({"OTIO_SCHEMA": "SerializableObject.1", "metadata": {"a": 1}})",
+            &plain,
+            &err,
+            true));
+        auto const plain_object =
+            std::any_cast<SerializableObject::Retainer<>>(plain);
+        auto const metadata = std::any_cast<otio::AnyDictionary>(
+            plain_object->dynamic_fields()["metadata"]);
+        assertEqual(std::any_cast<int64_t>(metadata.at("a")), int64_t(1));
+    });
+
     tests.run(argc, argv);
     return 0;
 }
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/gap.h>
+#include <opentimelineio/stack.h>
+#include <opentimelineio/structureTable.h>
+#include <opentimelineio/timeline.h>
+#include <opentimelineio/track.h>
+
+#include <iostream>
+
+namespace otime = opentime::OPENTIME_VERSION;
+namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
+
+namespace {
+
+otio::TimeRange
+frames(double start, double duration, double rate = 24)
+{
+    return otio::TimeRange(
+        otio::RationalTime(start, rate),
+        otio::RationalTime(duration, rate));
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    // video
+    //   gap    [0, 10)
+    //   clip_a [10, 30)  source 100-120
+    //   nested [30, 50)  source 5-25 of
+    //     lower
+    //       clip_c       source 50-80
+    // audio, at 48
+    //   clip_d [0, 40)   source 10-50
+    using otio::SerializableObject;
+    SerializableObject::Retainer<otio::Timeline> timeline =
+        new otio::Timeline("timeline");
+    SerializableObject::Retainer<otio::Track> video = new otio::Track("video");
+    SerializableObject::Retainer<otio::Track> audio = new otio::Track("audio");
+    SerializableObject::Retainer<otio::Gap> gap = new otio::Gap(frames(0, 10));
+    SerializableObject::Retainer<otio::Clip> clip_a =
+        new otio::Clip("a", nullptr, frames(100, 20));
+    SerializableObject::Retainer<otio::Stack> nested =
+        new otio::Stack("nested", frames(5, 20));
+    SerializableObject::Retainer<otio::Track> lower = new otio::Track("lower");
+    SerializableObject::Retainer<otio::Clip> clip_c =
+        new otio::Clip("c", nullptr, frames(50, 30));
+    SerializableObject::Retainer<otio::Clip> clip_d =
+        new otio::Clip("d", nullptr, frames(10, 40, 48));
+
+    timeline->tracks()->append_child(video);
+    timeline->tracks()->append_child(audio);
+    video->append_child(gap);
+    video->append_child(clip_a);
+    video->append_child(nested);
+    nested->append_child(lower);
+    lower->append_child(clip_c);
+    clip_d->set_enabled(false);
+    audio->append_child(clip_d);
+
+    tests.add_test("test_build", [&] {
+        otio::ErrorStatus err;
+        auto const table = otio::StructureTable::build(timeline, &err);
+        assertFalse(otio::is_error(err));
+        assertEqual(table.size(), size_t(9));
+
+        struct Expected
+        {
+            otio::Composable const*    object;
+            otio::StructureTable::Kind kind;
+            double                     start;
+            double                     duration;
+            double                     rate;
+            double                     source_start;
+            int32_t                    depth;
+            int64_t                    parent;
+            int32_t                    track_index;
+        };
+        Expected const rows[] = {
+            { timeline->tracks(), otio::StructureTable::stack, 0, 50, 24, 0, 0,
+              -1, -1 },
+            { video, otio::StructureTable::track, 0, 50, 24, 0, 1, 0, 0 },
+            { gap, otio::StructureTable::gap, 0, 10, 24, 0, 2, 1, 0 },
+            { clip_a, otio::StructureTable::clip, 10, 20, 24, 100, 2, 1, 0 },
+            { nested, otio::StructureTable::stack, 30, 20, 24, 5, 2, 1, 0 },
+            { lower, otio::StructureTable::track, 25, 30, 24, 0, 3, 4, 0 },
+            { clip_c, otio::StructureTable::clip, 25, 30, 24, 50, 4, 5, 0 },
+            { audio, otio::StructureTable::track, 0, 40, 48, 0, 1, 0, 1 },
+            { clip_d, otio::StructureTable::clip, 0, 40, 48, 10, 2, 7, 1 },
+        };
+        for (size_t i = 0; i < table.size(); ++i)
+        {
+            Expected const& row = rows[i];
+            assertEqual(table.object(i), row.object);
+            assertEqual(int(table.kind()[i]), int(row.kind));
+            assertEqual(table.start()[i], row.start);
+            assertEqual(table.duration()[i], row.duration);
+            assertEqual(table.rate()[i], row.rate);
+            assertEqual(table.source_start()[i], row.source_start);
+            assertEqual(table.depth()[i], row.depth);
+            assertEqual(table.parent()[i], row.parent);
+            assertEqual(table.track_index()[i], row.track_index);
+        }
+
+        assertEqual(int(table.enabled()[3]), 1);
+        assertEqual(int(table.enabled()[8]), 0);
+    });
+
+    tests.add_test("test_names", [&] {
+        auto const table = otio::StructureTable::build(timeline);
+        assertEqual(std::string(table.name(1)), std::string("video"));
+        assertEqual(std::string(table.name(3)), std::string("a"));
+        assertEqual(std::string(table.name(8)), std::string("d"));
+        assertEqual(table.name_offsets().size(), table.size() + 1);
+        assertEqual(
+            table.name_offsets().back(),
+            uint64_t(table.names().size()));
+    });
+
+    tests.add_test("test_matches_range_in_parent", [&] {
+        auto const table = otio::StructureTable::build(video.value);
+        assertEqual(table.size(), size_t(6));
+        for (size_t i = 1; i < table.size(); ++i)
+        {
+            if (table.parent()[i] != 0)
+            {
+                continue;
+            }
+            auto const item =
+                dynamic_cast<otio::Item const*>(table.object(i));
+            otio::TimeRange const range = item->range_in_parent();
+            assertEqual(table.start()[i], range.start_time().value());
+            assertEqual(table.duration()[i], range.duration().value());
+        }
+    });
+
+    tests.add_test("test_error", [&] {
+        SerializableObject::Retainer<otio::Track> track = new otio::Track();
+        track->append_child(new otio::Clip("no range"));
+        otio::ErrorStatus err;
+        auto const table = otio::StructureTable::build(track.value, &err);
+        assertTrue(otio::is_error(err));
+        assertEqual(table.size(), size_t(0));
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
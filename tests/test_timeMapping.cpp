@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "utils.h"
+
+#include <opentimelineio/clip.h>
+#include <opentimelineio/freezeFrame.h>
+#include <opentimelineio/gap.h>
+#include <opentimelineio/linearTimeWarp.h>
+#include <opentimelineio/stack.h>
+#include <opentimelineio/timeMapping.h>
+#include <opentimelineio/track.h>
+
+#include <iostream>
+
+namespace otime = opentime::OPENTIME_VERSION;
+namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
+
+namespace {
+
+otio::TimeRange
+frames(double start, double duration)
+{
+    return otio::TimeRange(
+        otio::RationalTime(start, 24),
+        otio::RationalTime(duration, 24));
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    Tests tests;
+
+    // stack
+    //   track
+    //     gap    [0, 10)
+    //     clip_a [10, 30)  source 100-120
+    //     nested [30, 45)  source 5-20 of
+    //       track
+    //         clip_b       source 0-8
+    //         clip_c       source 50-70
+    using otio::SerializableObject;
+    SerializableObject::Retainer<otio::Stack> stack  = new otio::Stack();
+    SerializableObject::Retainer<otio::Track> track  = new otio::Track();
+    SerializableObject::Retainer<otio::Clip>  clip_a = new otio::Clip(
+        "a",
+        nullptr,
+        frames(100, 20));
+    SerializableObject::Retainer<otio::Stack> nested = new otio::Stack(
+        "nested",
+        frames(5, 15));
+    SerializableObject::Retainer<otio::Track> inner = new otio::Track();
+    SerializableObject::Retainer<otio::Clip>  clip_b =
+        new otio::Clip("b", nullptr, frames(0, 8));
+    SerializableObject::Retainer<otio::Clip> clip_c =
+        new otio::Clip("c", nullptr, frames(50, 20));
+
+    stack->append_child(track);
+    track->append_child(new otio::Gap(frames(0, 10)));
+    track->append_child(clip_a);
+    track->append_child(nested);
+    nested->append_child(inner);
+    inner->append_child(clip_b);
+    inner->append_child(clip_c);
+
+    tests.add_test("test_matches_transformed_time", [&] {
+        otio::Item const* pairs[][2] = {
+            { clip_a, stack },  { stack, clip_a }, { clip_a, clip_c },
+            { clip_c, clip_a }, { clip_c, track }, { clip_b, clip_b },
+        };
+        for (auto const& pair: pairs)
+        {
+            otio::TimeMapping mapping(pair[0], pair[1]);
+            for (double value: { 0.0, 7.0, 104.0, 55.5 })
+            {
+                otio::RationalTime const time(value, 24);
+                otio::ErrorStatus        err;
+                otio::RationalTime const mapped = mapping.applied_to(time, &err);
+                assertFalse(otio::is_error(err));
+                assertEqual(mapped, pair[0]->transformed_time(time, pair[1]));
+            }
+            assertTrue(mapping.is_current());
+        }
+
+        // clip_c content frame 50 is frame 8 of the inner track, frame 3 of
+        // nested's trimmed range, and so frame 33 of the outer track
+        otio::TimeMapping mapping(clip_c, track);
+        assertEqual(
+            mapping.applied_to(otio::RationalTime(50, 24)),
+            otio::RationalTime(33, 24));
+        assertEqual(
+            mapping.applied_to(frames(50, 4)),
+            frames(33, 4));
+    });
+
+    tests.add_test("test_recompiles_after_edits", [&] {
+        otio::TimeMapping mapping(stack, clip_a);
+        otio::RationalTime const time(12, 24);
+        assertEqual(mapping.applied_to(time), otio::RationalTime(102, 24));
+        assertTrue(mapping.is_current());
+
+        track->insert_child(0, new otio::Gap(frames(0, 5)));
+        assertFalse(mapping.is_current());
+        assertEqual(mapping.applied_to(time), otio::RationalTime(97, 24));
+
+        clip_a->set_source_range(frames(200, 20));
+        assertFalse(mapping.is_current());
+        assertEqual(mapping.applied_to(time), otio::RationalTime(197, 24));
+
+        // edits below the items still reach the root
+        otio::TimeMapping inner_mapping(stack, clip_c);
+        inner_mapping.applied_to(time);
+        clip_b->set_source_range(frames(0, 4));
+        assertFalse(inner_mapping.is_current());
+        assertFalse(mapping.is_current());
+
+        track->remove_child(0);
+        clip_a->set_source_range(frames(100, 20));
+        clip_b->set_source_range(frames(0, 8));
+        assertEqual(mapping.applied_to(time), otio::RationalTime(102, 24));
+
+        // edits that are not tracked need an explicit invalidate()
+        SerializableObject::Retainer<otio::LinearTimeWarp> warp =
+            new otio::LinearTimeWarp("warp", "", 2);
+        clip_a->effects().push_back(warp.value);
+        otio::TimeMapping warped(stack, clip_a, true);
+        assertEqual(warped.applied_to(time), otio::RationalTime(104, 24));
+        warp->set_time_scalar(3);
+        assertTrue(warped.is_current());
+        warped.invalidate();
+        assertEqual(warped.applied_to(time), otio::RationalTime(106, 24));
+        clip_a->effects().clear();
+    });
+
+    tests.add_test("test_time_effects", [&] {
+        clip_a->effects().push_back(new otio::LinearTimeWarp("warp", "", 2));
+
+        otio::TimeMapping down(stack, clip_a, true);
+        otio::TimeMapping up(clip_a, stack, true);
+        for (double frame = 10; frame < 30; frame += 1)
+        {
+            otio::RationalTime const time(frame, 24);
+            otio::RationalTime const expected(100 + (frame - 10) * 2, 24);
+            assertEqual(down.applied_to(time), expected);
+            assertEqual(up.applied_to(expected), time);
+        }
+
+        // without time effects the warp is ignored, as by transformed_time()
+        otio::TimeMapping plain(stack, clip_a);
+        assertEqual(
+            plain.applied_to(otio::RationalTime(12, 24)),
+            otio::RationalTime(102, 24));
+
+        clip_a->effects().clear();
+        clip_a->effects().push_back(new otio::FreezeFrame());
+        down.invalidate();
+        up.invalidate();
+        assertEqual(
+            down.applied_to(otio::RationalTime(25, 24)),
+            otio::RationalTime(100, 24));
+
+        otio::ErrorStatus err;
+        up.applied_to(otio::RationalTime(100, 24), &err);
+        assertEqual(err.outcome, otio::ErrorStatus::INVALID_TIME_RANGE);
+        clip_a->effects().clear();
+    });
+
+    tests.add_test("test_unrelated_items", [&] {
+        SerializableObject::Retainer<otio::Clip> loose = new otio::Clip();
+        otio::TimeMapping                         mapping(clip_a, loose);
+        otio::ErrorStatus                         err;
+        mapping.applied_to(otio::RationalTime(1, 24), &err);
+        assertEqual(err.outcome, otio::ErrorStatus::NOT_DESCENDED_FROM);
+
+        otio::TimeMapping identity(clip_a, nullptr);
+        assertEqual(
+            identity.applied_to(otio::RationalTime(1, 24)),
+            otio::RationalTime(1, 24));
+    });
+
+    tests.run(argc, argv);
+    return 0;
+}
@@ -6,7 +6,9 @@
 #include <opentimelineio/clip.h>
 #include <opentimelineio/stack.h>
 #include <opentimelineio/track.h>
+#include <opentimelineio/transition.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace otime = opentime::OPENTIME_VERSION;
@@ -166,6 +168,114 @@ main(int argc, char** argv)
             std::find(items.begin(), items.end(), clip.value) != items.end());
     });
 
+    tests.add_test(
+        "test_range_of_all_children_exact", [] {
+        using namespace otio;
+        double const ntsc = 24000.0 / 1001.0;
+
+        // alternate 23.976 and 24 frames, whose sum never lands on a whole
+        // frame at either rate until 1000 pairs have gone by
+        SerializableObject::Retainer<Track> track = new Track();
+        for (int i = 0; i < 10000; ++i)
+        {
+            track->append_child(new Clip(
+                "a",
+                nullptr,
+                TimeRange(RationalTime(0, ntsc), RationalTime(1, ntsc))));
+            track->append_child(new Clip(
+                "b",
+                nullptr,
+                TimeRange(RationalTime(0, 24), RationalTime(1, 24))));
+        }
+        SerializableObject::Retainer<Clip> last = new Clip(
+            "last",
+            nullptr,
+            TimeRange(RationalTime(0, 24), RationalTime(1, 24)));
+        track->append_child(last);
+
+        otio::ErrorStatus err;
+        auto ranges = track->range_of_all_children(&err);
+        assertFalse(is_error(err));
+        assertTrue(ranges[last.value].start_time().strictly_equal(
+            RationalTime(20010, 24)));
+
+        // a fractional duration falls back to floating point sums
+        track->insert_child(
+            0,
+            new Clip(
+                "half",
+                nullptr,
+                TimeRange(RationalTime(0, 24), RationalTime(0.5, 24))));
+        ranges = track->range_of_all_children(&err);
+        assertFalse(is_error(err));
+        assertTrue(ranges[last.value].start_time().almost_equal(
+            RationalTime(20010.5, 24),
+            1e-6));
+    });
+
+    tests.add_test(
+        "test_range_start_rates_mixed_rate_track", [] {
+        using namespace otio;
+        double const ntsc = 30000.0 / 1001.0;
+
+        SerializableObject::Retainer<Track> track = new Track();
+        for (int i = 0; i < 50; ++i)
+        {
+            track->append_child(new Clip(
+                "ntsc",
+                nullptr,
+                TimeRange(RationalTime(0, ntsc), RationalTime(7, ntsc))));
+            track->append_child(new Clip(
+                "film",
+                nullptr,
+                TimeRange(RationalTime(0, 24), RationalTime(5, 24))));
+            if (i % 10 == 0)
+            {
+                track->append_child(new Transition(
+                    "dissolve",
+                    Transition::Type::SMPTE_Dissolve,
+                    RationalTime(2, 24),
+                    RationalTime(3, 24)));
+            }
+        }
+
+        // range_of_child_at_index() gives each start time at the largest
+        // rate before it, as adding up RationalTimes does, while
+        // range_of_all_children() gives it at the rate of the item before
+        // it.  Both are the same time.
+        otio::ErrorStatus err;
+        auto const ranges = track->range_of_all_children(&err);
+        assertFalse(is_error(err));
+        double max_rate  = 0;
+        double item_rate = ntsc;
+        for (int i = 0; i < int(track->children().size()); ++i)
+        {
+            auto const child = track->children()[i];
+            TimeRange const range = track->range_of_child_at_index(i, &err);
+            assertFalse(is_error(err));
+            TimeRange const& all = ranges.at(child.value);
+            assertTrue(range.duration().strictly_equal(all.duration()));
+            assertTrue(range.start_time().almost_equal(all.start_time(), 1e-6));
+
+            double const rate = range.duration().rate();
+            if (auto transition = dynamic_cast<Transition*>(child.value))
+            {
+                double const offset_rate = transition->in_offset().rate();
+                assertEqual(
+                    range.start_time().rate(),
+                    std::max({ max_rate, rate, offset_rate }));
+                assertEqual(
+                    all.start_time().rate(),
+                    std::max(item_rate, offset_rate));
+                continue;
+            }
+            assertEqual(range.start_time().rate(), std::max(max_rate, rate));
+            assertEqual(all.start_time().rate(), item_rate);
+            max_rate  = std::max(max_rate, rate);
+            item_rate = rate;
+        }
+    });
+
     tests.run(argc, argv);
     return 0;
 }